@@ -0,0 +1,171 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+//========================================================================================================
+/// AutonSimulator.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Runs auton scripts through CyclePrimitives in stepped simulation time.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/Timer.h>
+#include <frc/simulation/SimHooks.h>
+
+// Team 302 includes
+#include <AutonSimulator.h>
+#include <auton/AutonProgram.h>
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    /// names used in the auton xml, indexed by PRIMITIVE_IDENTIFIER
+    const char* PRIMITIVE_NAMES[MAX_AUTON_PRIMITIVES] = { "DO_NOTHING",
+                                                           "HOLD_POSITION",
+                                                           "DRIVE_DISTANCE",
+                                                           "DRIVE_TIME",
+                                                           "DRIVE_TO_WALL",
+                                                           "TURN_ANGLE_ABS",
+                                                           "TURN_ANGLE_REL",
+                                                           "DRIVE_PATH",
+                                                           "RESET_POSITION",
+                                                           "WAIT_FOR_MECHANISMS" };
+}
+
+AutonSimulator::AutonSimulator
+(
+    SimChassis*         chassis,
+    units::second_t     loopTime,
+    units::second_t     timeout
+) : m_chassis( chassis ),
+    m_cyclePrims(),
+    m_loopTime( loopTime ),
+    m_timeout( timeout )
+{
+}
+
+AutonSimulator::Result AutonSimulator::Run
+(
+    const string&       script
+)
+{
+    Result result;
+    result.script    = script;
+    result.finished  = false;
+    result.totalTime = units::second_t( 0.0 );
+
+    m_chassis->Stop();
+    m_chassis->ResetPose( frc::Pose2d() );
+
+    auto start = frc::Timer::GetFPGATimestamp();
+    m_cyclePrims.Start( script );
+
+    // Run clears the program when the script finishes, so keep the ids for the report.  Simulated time
+    // runs much faster than the generator thread, so let every path finish first; otherwise a DrivePath
+    // holds still for however many loops the host machine needs and the times aren't repeatable.
+    vector<PRIMITIVE_IDENTIFIER> ids;
+    auto& program = m_cyclePrims.GetProgram();
+    for ( size_t inx=0; inx<program.GetSize(); ++inx )
+    {
+        auto prim = program.GetPrimitive( inx );
+        ids.emplace_back( prim->GetID() );
+
+        auto path = prim->GetGeneratedPath();
+        if ( path.valid() )
+        {
+            path.wait();
+        }
+    }
+    if ( ids.empty() )
+    {
+        result.finalPose = m_chassis->GetPose();
+        return result;
+    }
+
+    // a step ends when CyclePrimitives moves on to the next slot or finishes the script
+    auto stepBegin = 0;
+    auto stepEnd   = m_cyclePrims.GetPrimSlot();
+    auto stepStart = start;
+    while ( !m_cyclePrims.AtTarget() && frc::Timer::GetFPGATimestamp() - start < m_timeout )
+    {
+        m_cyclePrims.Run();
+        m_chassis->Step( m_loopTime );
+        frc::sim::StepTiming( m_loopTime );
+
+        if ( m_cyclePrims.AtTarget() || m_cyclePrims.GetPrimSlot() != stepEnd )
+        {
+            auto now = frc::Timer::GetFPGATimestamp();
+            result.steps.emplace_back( StepResult{ StepName( ids, stepBegin, stepEnd ), now - stepStart } );
+            stepBegin = stepEnd;
+            stepEnd   = m_cyclePrims.GetPrimSlot();
+            stepStart = now;
+        }
+    }
+
+    result.finished  = m_cyclePrims.AtTarget();
+    result.totalTime = frc::Timer::GetFPGATimestamp() - start;
+    result.finalPose = m_chassis->GetPose();
+    return result;
+}
+
+void AutonSimulator::Print
+(
+    const Result&       result
+)
+{
+    printf( "%s\n", result.script.c_str() );
+    printf( "  %4s  %9s  %s\n", "step", "time (s)", "primitives" );
+    for ( unsigned int inx=0; inx<result.steps.size(); ++inx )
+    {
+        printf( "  %4u  %9.3f  %s\n", inx, result.steps[inx].duration.to<double>(), result.steps[inx].primitives.c_str() );
+    }
+    printf( "  total %.3f s%s\n", result.totalTime.to<double>(), result.finished ? "" : " (did not finish)" );
+    printf( "  final pose x %.3f m  y %.3f m  heading %.1f deg\n\n", result.finalPose.X().to<double>(),
+                                                                     result.finalPose.Y().to<double>(),
+                                                                     result.finalPose.Rotation().Degrees().to<double>() );
+}
+
+string AutonSimulator::StepName
+(
+    const vector<PRIMITIVE_IDENTIFIER>&     ids,
+    int                                     begin,
+    int                                     end
+)
+{
+    string name;
+    for ( auto inx=begin; inx<end && inx<static_cast<int>( ids.size() ); ++inx )
+    {
+        auto id = ids[inx];
+        if ( !name.empty() )
+        {
+            name += string("+");
+        }
+        name += ( id >= 0 && id < MAX_AUTON_PRIMITIVES ) ? string( PRIMITIVE_NAMES[id] ) : string("UNKNOWN_PRIMITIVE");
+    }
+    return name;
+}
@@ -0,0 +1,99 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+//========================================================================================================
+/// AutonSimulator.h
+//========================================================================================================
+///
+/// File Description:
+///     Runs auton scripts through CyclePrimitives against a SimChassis in stepped simulation time.
+///     The HAL clock only moves when a loop is stepped, so the primitives' timers see robot loop
+///     time while the simulation runs as fast as the CPU allows.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <auton/CyclePrimitives.h>
+#include <auton/PrimitiveEnums.h>
+#include <SimChassis.h>
+
+// Third Party Includes
+
+
+class AutonSimulator
+{
+    public:
+        /// @brief time spent on one primitive (or group of primitives)
+        struct StepResult
+        {
+            std::string         primitives;     // ids, '+' between the members of a group
+            units::second_t     duration;
+        };
+
+        /// @brief result of simulating one script
+        struct Result
+        {
+            std::string                 script;
+            bool                        finished;   // false if it had no primitives or ran past the timeout
+            units::second_t             totalTime;
+            std::vector<StepResult>     steps;
+            frc::Pose2d                 finalPose;
+        };
+
+        AutonSimulator
+        (
+            SimChassis*         chassis,
+            units::second_t     loopTime,
+            units::second_t     timeout
+        );
+        ~AutonSimulator() = default;
+
+        /// @brief simulate a script from the origin
+        /// @param [in] std::string: path to the auton xml
+        Result Run
+        (
+            const std::string&  script
+        );
+
+        /// @brief write a result as a table on the console
+        static void Print
+        (
+            const Result&       result
+        );
+
+    private:
+        static std::string StepName
+        (
+            const std::vector<PRIMITIVE_IDENTIFIER>&    ids,
+            int                                         begin,
+            int                                         end
+        );
+
+        SimChassis*             m_chassis;
+        CyclePrimitives         m_cyclePrims;
+        units::second_t         m_loopTime;
+        units::second_t         m_timeout;
+};
@@ -0,0 +1,149 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+//========================================================================================================
+/// SimChassis.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Chassis model for the desktop auton simulator.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+
+// FRC includes
+#include <frc/geometry/Twist2d.h>
+#include <units/math.h>
+
+// Team 302 includes
+#include <SimChassis.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    /// @brief move value toward target by at most maxChange
+    double Approach
+    (
+        double      value,
+        double      target,
+        double      maxChange
+    )
+    {
+        return value + clamp( target - value, -maxChange, maxChange );
+    }
+}
+
+SimChassis::SimChassis
+(
+    units::meters_per_second_t                      maxSpeed,
+    units::meters_per_second_squared_t              maxAcceleration,
+    units::degrees_per_second_t                     maxAngularSpeed,
+    units::degrees_per_second_squared_t             maxAngularAcceleration,
+    bool                                            holonomic
+) : m_maxSpeed( maxSpeed ),
+    m_maxAcceleration( maxAcceleration ),
+    m_maxAngularSpeed( maxAngularSpeed ),
+    m_maxAngularAcceleration( maxAngularAcceleration ),
+    m_holonomic( holonomic ),
+    m_commanded(),
+    m_speeds(),
+    m_pose()
+{
+}
+
+void SimChassis::Drive
+(
+    frc::ChassisSpeeds          chassisSpeeds
+)
+{
+    m_commanded = chassisSpeeds;
+    if ( !m_holonomic )
+    {
+        m_commanded.vy = units::meters_per_second_t( 0.0 );
+    }
+}
+
+void SimChassis::DriveFieldOriented
+(
+    frc::ChassisSpeeds          fieldSpeeds
+)
+{
+    Drive( frc::ChassisSpeeds::FromFieldRelativeSpeeds( fieldSpeeds.vx, fieldSpeeds.vy, fieldSpeeds.omega, m_pose.Rotation() ) );
+}
+
+void SimChassis::ResetPose
+(
+    const frc::Pose2d&          pose
+)
+{
+    m_pose = pose;
+}
+
+units::length::inch_t SimChassis::GetWheelDiameter() const
+{
+    return units::length::inch_t( 6.0 );
+}
+
+units::length::inch_t SimChassis::GetTrack() const
+{
+    return units::length::inch_t( 22.0 );
+}
+
+bool SimChassis::IsMoving() const
+{
+    return units::math::abs( m_speeds.vx ) > units::meters_per_second_t( 0.01 ) ||
+           units::math::abs( m_speeds.vy ) > units::meters_per_second_t( 0.01 ) ||
+           units::math::abs( m_speeds.omega ) > units::radians_per_second_t( 0.01 );
+}
+
+void SimChassis::Stop()
+{
+    m_commanded = frc::ChassisSpeeds();
+    m_speeds    = frc::ChassisSpeeds();
+}
+
+void SimChassis::Step
+(
+    units::second_t             delta
+)
+{
+    // limit the commands to what the chassis can do
+    auto maxSpeed = m_maxSpeed.to<double>();
+    auto vx = clamp( m_commanded.vx.to<double>(), -maxSpeed, maxSpeed );
+    auto vy = clamp( m_commanded.vy.to<double>(), -maxSpeed, maxSpeed );
+    auto maxOmega = units::radians_per_second_t( m_maxAngularSpeed ).to<double>();
+    auto omega = clamp( m_commanded.omega.to<double>(), -maxOmega, maxOmega );
+
+    // then accelerate toward them; translation shares one acceleration limit
+    auto maxChange = m_maxAcceleration.to<double>() * delta.to<double>();
+    auto dvx = vx - m_speeds.vx.to<double>();
+    auto dvy = vy - m_speeds.vy.to<double>();
+    auto change = hypot( dvx, dvy );
+    auto scale = change > maxChange ? maxChange / change : 1.0;
+    m_speeds.vx = units::meters_per_second_t( m_speeds.vx.to<double>() + dvx * scale );
+    m_speeds.vy = units::meters_per_second_t( m_speeds.vy.to<double>() + dvy * scale );
+
+    auto maxOmegaChange = units::radians_per_second_squared_t( m_maxAngularAcceleration ).to<double>() * delta.to<double>();
+    m_speeds.omega = units::radians_per_second_t( Approach( m_speeds.omega.to<double>(), omega, maxOmegaChange ) );
+
+    m_pose = m_pose.Exp( frc::Twist2d{ m_speeds.vx * delta, m_speeds.vy * delta, m_speeds.omega * delta } );
+}
@@ -0,0 +1,105 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+//========================================================================================================
+/// SimChassis.h
+//========================================================================================================
+///
+/// File Description:
+///     Chassis model for the desktop auton simulator.  The commanded speeds are reached at the
+///     acceleration limits and the pose is integrated each step, so a script takes about as long as
+///     it does on the field without any motor controllers or sensors.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <units/acceleration.h>
+#include <units/angular_acceleration.h>
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+#include <subsys/interfaces/IChassis.h>
+
+// Third Party Includes
+
+
+class SimChassis : public IChassis
+{
+    public:
+        SimChassis
+        (
+            units::meters_per_second_t                      maxSpeed,
+            units::meters_per_second_squared_t              maxAcceleration,
+            units::degrees_per_second_t                     maxAngularSpeed,
+            units::degrees_per_second_squared_t             maxAngularAcceleration,
+            bool                                            holonomic
+        );
+        ~SimChassis() = default;
+
+        void Drive
+        (
+            frc::ChassisSpeeds          chassisSpeeds
+        ) override;
+
+        void DriveFieldOriented
+        (
+            frc::ChassisSpeeds          fieldSpeeds
+        ) override;
+
+        bool IsHolonomic() const override { return m_holonomic; }
+
+        frc::Pose2d GetPose() const override { return m_pose; }
+        void ResetPose
+        (
+            const frc::Pose2d&          pose
+        ) override;
+
+        void UpdatePose() override {}
+        units::length::inch_t GetWheelDiameter() const override;
+        units::length::inch_t GetTrack() const override;
+        units::velocity::meters_per_second_t GetMaxSpeed() const override { return m_maxSpeed; }
+        units::angular_velocity::degrees_per_second_t GetMaxAngularSpeed() const override { return m_maxAngularSpeed; }
+        bool IsMoving() const override;
+
+        /// @brief stop and clear the commanded speeds (between scripts)
+        void Stop();
+
+        /// @brief move the speeds toward the commanded speeds and integrate the pose
+        /// @param [in] units::second_t: simulated time since the last step
+        void Step
+        (
+            units::second_t             delta
+        );
+
+    private:
+        units::meters_per_second_t              m_maxSpeed;
+        units::meters_per_second_squared_t      m_maxAcceleration;
+        units::degrees_per_second_t             m_maxAngularSpeed;
+        units::degrees_per_second_squared_t     m_maxAngularAcceleration;
+        bool                                    m_holonomic;
+        frc::ChassisSpeeds                      m_commanded;    // robot relative
+        frc::ChassisSpeeds                      m_speeds;       // robot relative
+        frc::Pose2d                             m_pose;
+};
@@ -0,0 +1,178 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+//========================================================================================================
+/// main.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Desktop auton simulator.  Runs each auton script given on the command line through
+///     CyclePrimitives against a simulated chassis, faster than real time, and reports the total
+///     time, the time of each primitive (or group) and the final pose:
+///         ./gradlew autonSimulatorReleaseExecutable
+///         <executable> src/main/autonxml/timedauto.xml [more scripts] [options]
+///     Run it from the repository root so paths load from src/main/deploy/paths.  With no robot
+///     definition loaded the mechanisms are modeled by a time to reach each state (see INTAKE_TIMES etc.),
+///     so WAIT_FOR_MECHANISMS and the groups waiting on it take about as long as on the robot.
+///
+///     Options:
+///         --loop=<seconds>                robot loop time (default 0.02)
+///         --timeout=<seconds>             give up on a script after this long (default 15)
+///         --maxspeed=<m/s>                chassis max speed (default 3.5)
+///         --maxaccel=<m/s^2>              chassis max acceleration (default 3.5)
+///         --maxturn=<deg/s>               chassis max turn rate (default 360)
+///         --holonomic                     the chassis can strafe (swerve, mecanum)
+///         --mechscale=<factor>            scale the mechanism times to target (default 1, 0 reaches them at once)
+///
+//========================================================================================================
+
+// C++ Includes
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/simulation/SimHooks.h>
+#include <hal/HAL.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <AutonSimulator.h>
+#include <SimChassis.h>
+#include <states/StateMgr.h>
+#include <states/arm/ArmStateMgr.h>
+#include <states/ballrelease/BallReleaseStateMgr.h>
+#include <states/balltransfer/BallTransferStateMgr.h>
+#include <states/intake/IntakeStateMgr.h>
+#include <subsys/ChassisFactory.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    /// @brief read a --name=value option; returns false (value untouched) if arg isn't that option
+    bool ParseOption
+    (
+        const char*     arg,
+        const char*     name,
+        double&         value
+    )
+    {
+        auto length = strlen( name );
+        if ( strncmp( arg, name, length ) != 0 || arg[length] != '=' )
+        {
+            return false;
+        }
+        value = atof( arg + length + 1 );
+        return true;
+    }
+
+    using MechanismTimes = std::array<units::second_t, StateMgr::MAX_STATES>;
+
+    /// rough times for the 2021 robot's mechanisms to reach each state (seconds), indexed by state id;
+    /// holding and stopping states are reached right away
+    const MechanismTimes INTAKE_TIMES   = { 0_s, 0.25_s, 0.25_s };              // OFF, INTAKE, EXPEL
+    const MechanismTimes TRANSFER_TIMES = { 0_s, 0.25_s, 0.25_s };              // OFF, INTAKE, EXPEL
+    const MechanismTimes ARM_TIMES      = { 1.0_s, 1.0_s, 0_s, 0_s, 0_s };      // GOING_UP, GOING_DOWN, UP_POS, DOWN_POS, HOLD_POSITION
+    const MechanismTimes RELEASE_TIMES  = { 0_s, 0.5_s };                       // HOLD, RELEASE
+
+    /// @brief have a state manager model its mechanism with the times scaled by scale
+    void SimulateMechanism
+    (
+        StateMgr*               stateMgr,
+        const MechanismTimes&   times,
+        double                  scale
+    )
+    {
+        if ( stateMgr != nullptr )
+        {
+            MechanismTimes scaled;
+            for ( size_t inx=0; inx<times.size(); ++inx )
+            {
+                scaled[inx] = times[inx] * scale;
+            }
+            stateMgr->SimulateMechanism( scaled );
+        }
+    }
+}
+
+int main( int argc, char** argv ) 
+{
+    HAL_Initialize( 500, 0 );
+
+    // the clock only moves when the simulator steps it
+    frc::sim::PauseTiming();
+
+    double loopTime  = 0.02;
+    double timeout   = 15.0;
+    double maxSpeed  = 3.5;
+    double maxAccel  = 3.5;
+    double maxTurn   = 360.0;
+    double mechScale = 1.0;
+    bool   holonomic = false;
+    vector<string> scripts;
+    for ( auto inx=1; inx<argc; ++inx )
+    {
+        auto arg = argv[inx];
+        if ( strcmp( arg, "--holonomic" ) == 0 )
+        {
+            holonomic = true;
+        }
+        else if ( !ParseOption( arg, "--loop", loopTime ) &&
+                  !ParseOption( arg, "--timeout", timeout ) &&
+                  !ParseOption( arg, "--maxspeed", maxSpeed ) &&
+                  !ParseOption( arg, "--maxaccel", maxAccel ) &&
+                  !ParseOption( arg, "--maxturn", maxTurn ) &&
+                  !ParseOption( arg, "--mechscale", mechScale ) )
+        {
+            scripts.emplace_back( string( arg ) );
+        }
+    }
+    if ( scripts.empty() || loopTime <= 0.0 || mechScale < 0.0 )
+    {
+        printf( "usage: %s <auton xml> [more auton xml] [--loop=s] [--timeout=s] [--maxspeed=m/s] [--maxaccel=m/s^2] [--maxturn=deg/s] [--holonomic] [--mechscale=factor]\n", argv[0] );
+        return 1;
+    }
+
+    // the primitives pick up the chassis when they are created, so install the model first
+    auto chassis = new SimChassis( units::meters_per_second_t( maxSpeed ),
+                                   units::meters_per_second_squared_t( maxAccel ),
+                                   units::degrees_per_second_t( maxTurn ),
+                                   units::degrees_per_second_squared_t( maxTurn * 4.0 ),     // full turn rate in a quarter second
+                                   holonomic );
+    ChassisFactory::GetChassisFactory()->SetIChassis( chassis );
+
+    // CyclePrimitives sets these states, so model the mechanisms before the simulator creates it
+    SimulateMechanism( IntakeStateMgr::GetInstance(), INTAKE_TIMES, mechScale );
+    SimulateMechanism( BallTransferStateMgr::GetInstance(), TRANSFER_TIMES, mechScale );
+    SimulateMechanism( ArmStateMgr::GetInstance(), ARM_TIMES, mechScale );
+    SimulateMechanism( BallReleaseStateMgr::GetInstance(), RELEASE_TIMES, mechScale );
+
+    AutonSimulator simulator( chassis, units::second_t( loopTime ), units::second_t( timeout ) );
+    auto allFinished = true;
+    for ( auto& script : scripts )
+    {
+        auto result = simulator.Run( script );
+        AutonSimulator::Print( result );
+        allFinished = allFinished && result.finished;
+    }
+    return allFinished ? 0 : 1;
+}
@@ -0,0 +1,284 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// BenchmarkRunner.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Runs the registered benchmarks and writes the console table / JSON results.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <BenchmarkRunner.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    constexpr uint64_t MAX_ITERATIONS = 1000000000;
+
+    string JsonEscape
+    (
+        const string&   text
+    )
+    {
+        string escaped;
+        for ( auto ch : text )
+        {
+            switch ( ch )
+            {
+                case '"':  escaped += "\\\""; break;
+                case '\\': escaped += "\\\\"; break;
+                case '\n': escaped += "\\n";  break;
+                case '\t': escaped += "\\t";  break;
+                default:   escaped += ch;     break;
+            }
+        }
+        return escaped;
+    }
+}
+
+BenchmarkState::BenchmarkState
+(
+    uint64_t    iterations
+) : m_iterations( iterations ),
+    m_remaining( iterations ),
+    m_running( false ),
+    m_skipped( false ),
+    m_error(),
+    m_realStart(),
+    m_cpuStart( 0 ),
+    m_realSeconds( 0.0 ),
+    m_cpuSeconds( 0.0 )
+{
+}
+
+void BenchmarkState::SkipWithError
+(
+    const string&   message
+)
+{
+    m_skipped = true;
+    m_error   = message;
+}
+
+void BenchmarkState::StartTimer()
+{
+    m_running   = true;
+    m_cpuStart  = clock();
+    m_realStart = chrono::steady_clock::now();
+}
+
+void BenchmarkState::StopTimer()
+{
+    if ( m_running )
+    {
+        auto realEnd = chrono::steady_clock::now();
+        auto cpuEnd  = clock();
+        m_realSeconds = chrono::duration<double>( realEnd - m_realStart ).count();
+        m_cpuSeconds  = static_cast<double>( cpuEnd - m_cpuStart ) / CLOCKS_PER_SEC;
+        m_running     = false;
+    }
+}
+
+BenchmarkRunner::BenchmarkRunner
+(
+    int         argc,
+    char**      argv
+) : m_benchmarks(),
+    m_executable( argc > 0 ? argv[0] : "" ),
+    m_filter(),
+    m_outFile(),
+    m_minTime( 0.5 )
+{
+    const string filterOption  = "--benchmark_filter=";
+    const string outOption     = "--benchmark_out=";
+    const string minTimeOption = "--benchmark_min_time=";
+    for ( auto inx=1; inx<argc; ++inx )
+    {
+        string arg( argv[inx] );
+        if ( arg.rfind( filterOption, 0 ) == 0 )
+        {
+            m_filter = arg.substr( filterOption.size() );
+        }
+        else if ( arg.rfind( outOption, 0 ) == 0 )
+        {
+            m_outFile = arg.substr( outOption.size() );
+        }
+        else if ( arg.rfind( minTimeOption, 0 ) == 0 )
+        {
+            m_minTime = atof( arg.substr( minTimeOption.size() ).c_str() );
+        }
+        else
+        {
+            cerr << "BenchmarkRunner: unknown option " << arg << endl;
+        }
+    }
+}
+
+/// @brief add a benchmark; benchmarks run in the order they are registered
+void BenchmarkRunner::Register
+(
+    const string&       name,
+    BenchmarkFunction   function,
+    uint64_t            iterations
+)
+{
+    m_benchmarks.emplace_back( Benchmark{ name, function, iterations } );
+}
+
+/// @brief run the registered benchmarks and write the results
+/// @returns int 0 if every benchmark ran, 1 otherwise
+int BenchmarkRunner::Run()
+{
+    vector<Result> results;
+    auto failed = false;
+
+    cout << left << setw(48) << "Benchmark" << right << setw(16) << "Time (ns)" << setw(16) << "CPU (ns)" << setw(14) << "Iterations" << endl;
+    cout << string( 94, '-' ) << endl;
+    for ( const auto& benchmark : m_benchmarks )
+    {
+        if ( !m_filter.empty() && benchmark.name.find( m_filter ) == string::npos )
+        {
+            continue;
+        }
+
+        auto result = RunBenchmark( benchmark );
+        cout << left << setw(48) << result.name << right;
+        if ( result.error.empty() )
+        {
+            cout << fixed << setprecision(1) << setw(16) << result.realNsPerIteration << setw(16) << result.cpuNsPerIteration << setw(14) << result.iterations << endl;
+        }
+        else
+        {
+            cout << "ERROR: " << result.error << endl;
+            failed = true;
+        }
+        results.emplace_back( result );
+    }
+
+    if ( !m_outFile.empty() && !WriteJson( results ) )
+    {
+        cerr << "BenchmarkRunner: unable to write " << m_outFile << endl;
+        failed = true;
+    }
+    return failed ? 1 : 0;
+}
+
+BenchmarkRunner::Result BenchmarkRunner::RunBenchmark
+(
+    const Benchmark&    benchmark
+) const
+{
+    Result result{ benchmark.name, 0, 0.0, 0.0, string() };
+
+    // same approach as Google Benchmark: keep growing the iteration count until one run takes
+    // at least the minimum time, then report that run
+    auto iterations = benchmark.iterations > 0 ? benchmark.iterations : 1;
+    while ( true )
+    {
+        BenchmarkState state( iterations );
+        benchmark.function( state );
+        if ( state.IsSkipped() )
+        {
+            result.error = state.GetErrorMessage();
+            return result;
+        }
+
+        auto seconds = state.GetRealSeconds();
+        if ( benchmark.iterations > 0 || seconds >= m_minTime || iterations >= MAX_ITERATIONS )
+        {
+            result.iterations         = iterations;
+            result.realNsPerIteration = state.GetRealSeconds() * 1.0e9 / static_cast<double>( iterations );
+            result.cpuNsPerIteration  = state.GetCpuSeconds() * 1.0e9 / static_cast<double>( iterations );
+            return result;
+        }
+
+        auto multiplier = seconds > 0.0 ? min( max( m_minTime * 1.4 / seconds, 2.0 ), 10.0 ) : 10.0;
+        iterations = min( static_cast<uint64_t>( static_cast<double>( iterations ) * multiplier ), MAX_ITERATIONS );
+    }
+}
+
+bool BenchmarkRunner::WriteJson
+(
+    const vector<Result>&   results
+) const
+{
+    ofstream out( m_outFile );
+    if ( !out )
+    {
+        return false;
+    }
+
+    auto now = chrono::system_clock::to_time_t( chrono::system_clock::now() );
+    char date[32];
+    strftime( date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime( &now ) );
+
+    out << "{" << endl;
+    out << "  \"context\": {" << endl;
+    out << "    \"date\": \"" << date << "\"," << endl;
+    out << "    \"executable\": \"" << JsonEscape( m_executable ) << "\"," << endl;
+    out << "    \"num_cpus\": " << thread::hardware_concurrency() << "," << endl;
+    out << "    \"library_build_type\": \"release\"" << endl;
+    out << "  }," << endl;
+    out << "  \"benchmarks\": [" << endl;
+    for ( auto inx=0U; inx<results.size(); ++inx )
+    {
+        const auto& result = results[inx];
+        out << "    {" << endl;
+        out << "      \"name\": \"" << JsonEscape( result.name ) << "\"," << endl;
+        out << "      \"run_name\": \"" << JsonEscape( result.name ) << "\"," << endl;
+        out << "      \"run_type\": \"iteration\"," << endl;
+        out << "      \"repetitions\": 1," << endl;
+        out << "      \"repetition_index\": 0," << endl;
+        out << "      \"threads\": 1," << endl;
+        if ( !result.error.empty() )
+        {
+            out << "      \"error_occurred\": true," << endl;
+            out << "      \"error_message\": \"" << JsonEscape( result.error ) << "\"," << endl;
+        }
+        out << "      \"iterations\": " << result.iterations << "," << endl;
+        out << "      \"real_time\": " << setprecision(12) << result.realNsPerIteration << "," << endl;
+        out << "      \"cpu_time\": " << setprecision(12) << result.cpuNsPerIteration << "," << endl;
+        out << "      \"time_unit\": \"ns\"" << endl;
+        out << "    }" << ( inx + 1 < results.size() ? "," : "" ) << endl;
+    }
+    out << "  ]" << endl;
+    out << "}" << endl;
+    return out.good();
+}
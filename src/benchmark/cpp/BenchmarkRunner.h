@@ -0,0 +1,181 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// BenchmarkRunner.h
+//========================================================================================================
+///
+/// File Description:
+///     Small micro-benchmark harness for timing the robot's hot paths on the desktop (simulated HAL).
+///     Each benchmark is a function that sets itself up and then loops on state.KeepRunning(); the 
+///     runner grows the iteration count until the loop takes at least the minimum time.  Results are
+///     written as a console table and, with --benchmark_out=<file>, as JSON in the same layout as 
+///     Google Benchmark so its compare.py can diff two runs.
+///
+///     Options:
+///         --benchmark_filter=<text>       only run benchmarks whose name contains the text
+///         --benchmark_out=<file>          write the JSON results to the file
+///         --benchmark_min_time=<seconds>  minimum time to run each benchmark (default 0.5)
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class BenchmarkState
+{
+    public:
+        explicit BenchmarkState
+        (
+            uint64_t    iterations
+        );
+
+        /// @brief call as the loop condition; starts the timer on the first call and stops it once
+        ///        the requested number of iterations have been run
+        /// @returns bool true while there are iterations left
+        inline bool KeepRunning()
+        {
+            if ( m_remaining == m_iterations )
+            {
+                StartTimer();
+            }
+            if ( m_remaining == 0 || m_skipped )
+            {
+                StopTimer();
+                return false;
+            }
+            --m_remaining;
+            return true;
+        }
+
+        /// @brief stop the benchmark (e.g. a file it needs is missing); it is reported as an error
+        /// @param [in] std::string: reason the benchmark couldn't run
+        void SkipWithError
+        (
+            const std::string&  message
+        );
+
+        /// @brief keep the compiler from optimizing away a result that isn't otherwise used
+        template <typename T>
+        static inline void DoNotOptimize
+        (
+            const T&    value
+        )
+        {
+        #if defined(__GNUC__) || defined(__clang__)
+            asm volatile( "" : : "r,m"(value) : "memory" );
+        #else
+            static volatile const void* sink;
+            sink = &value;
+        #endif
+        }
+
+        uint64_t GetIterations() const { return m_iterations; }
+        double GetRealSeconds() const { return m_realSeconds; }
+        double GetCpuSeconds() const { return m_cpuSeconds; }
+        bool IsSkipped() const { return m_skipped; }
+        const std::string& GetErrorMessage() const { return m_error; }
+
+    private:
+        void StartTimer();
+        void StopTimer();
+
+        uint64_t                                m_iterations;
+        uint64_t                                m_remaining;
+        bool                                    m_running;
+        bool                                    m_skipped;
+        std::string                             m_error;
+        std::chrono::steady_clock::time_point   m_realStart;
+        std::clock_t                            m_cpuStart;
+        double                                  m_realSeconds;
+        double                                  m_cpuSeconds;
+};
+
+class BenchmarkRunner
+{
+    public:
+        using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+        BenchmarkRunner
+        (
+            int                 argc,
+            char**              argv
+        );
+        ~BenchmarkRunner() = default;
+
+        /// @brief add a benchmark; benchmarks run in the order they are registered
+        /// @param [in] std::string: benchmark name
+        /// @param [in] BenchmarkFunction: function to time
+        /// @param [in] uint64_t: fixed iteration count for one-shot work (0 lets the runner pick)
+        void Register
+        (
+            const std::string&  name,
+            BenchmarkFunction   function,
+            uint64_t            iterations = 0
+        );
+
+        /// @brief run the registered benchmarks and write the results
+        /// @returns int 0 if every benchmark ran, 1 otherwise (usable as the process exit code)
+        int Run();
+
+    private:
+        struct Benchmark
+        {
+            std::string         name;
+            BenchmarkFunction   function;
+            uint64_t            iterations;
+        };
+
+        struct Result
+        {
+            std::string         name;
+            uint64_t            iterations;
+            double              realNsPerIteration;
+            double              cpuNsPerIteration;
+            std::string         error;
+        };
+
+        Result RunBenchmark
+        (
+            const Benchmark&    benchmark
+        ) const;
+
+        bool WriteJson
+        (
+            const std::vector<Result>&  results
+        ) const;
+
+        std::vector<Benchmark>  m_benchmarks;
+        std::string             m_executable;
+        std::string             m_filter;
+        std::string             m_outFile;
+        double                  m_minTime;
+};
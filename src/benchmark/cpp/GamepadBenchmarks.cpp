@@ -0,0 +1,99 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// GamepadBenchmarks.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Times reading the driver's sticks through AnalogAxis and TeleopControl.
+///
+//========================================================================================================
+
+// C++ Includes
+
+// FRC includes
+#include <frc/GenericHID.h>
+#include <frc/simulation/DriverStationSim.h>
+
+// Team 302 includes
+#include <BenchmarkRunner.h>
+#include <RobotBenchmarks.h>
+#include <gamepad/IDragonGamePad.h>
+#include <gamepad/TeleopControl.h>
+#include <gamepad/axis/AnalogAxis.h>
+
+// Third Party Includes
+
+using namespace frc;
+
+namespace
+{
+    void BM_AnalogAxisGetAxisValue
+    (
+        BenchmarkState&     state
+    )
+    {
+        GenericHID gamepad( 0 );
+        AnalogAxis axis( &gamepad, IDragonGamePad::LEFT_JOYSTICK_Y, false );
+        axis.SetDeadBand( IDragonGamePad::AXIS_DEADBAND::APPLY_STANDARD_DEADBAND );
+        axis.SetAxisProfile( IDragonGamePad::AXIS_PROFILE::CUBED );
+
+        while ( state.KeepRunning() )
+        {
+            BenchmarkState::DoNotOptimize( axis.GetAxisValue() );
+        }
+    }
+
+    void BM_TeleopControlGetAxisValue
+    (
+        BenchmarkState&     state
+    )
+    {
+        auto controller = TeleopControl::GetInstance();
+        controller->SetAxisProfile( TeleopControl::FUNCTION_IDENTIFIER::ARCADE_THROTTLE, IDragonGamePad::AXIS_PROFILE::CUBED );
+        controller->SetDeadBand( TeleopControl::FUNCTION_IDENTIFIER::ARCADE_THROTTLE, IDragonGamePad::AXIS_DEADBAND::APPLY_STANDARD_DEADBAND );
+
+        while ( state.KeepRunning() )
+        {
+            BenchmarkState::DoNotOptimize( controller->GetAxisValue( TeleopControl::FUNCTION_IDENTIFIER::ARCADE_THROTTLE ) );
+        }
+    }
+}
+
+/// @brief make the simulated driver station report an xbox controller with its sticks pushed on port 0
+void SimulateXboxController()
+{
+    sim::DriverStationSim::SetJoystickIsXbox( 0, true );
+    sim::DriverStationSim::SetJoystickType( 0, GenericHID::kXInputGamepad );
+    sim::DriverStationSim::SetJoystickAxisCount( 0, 6 );
+    sim::DriverStationSim::SetJoystickButtonCount( 0, 10 );
+    for ( auto axis=0; axis<6; ++axis )
+    {
+        sim::DriverStationSim::SetJoystickAxis( 0, axis, 0.5 );
+    }
+    sim::DriverStationSim::NotifyNewData();
+}
+
+void RegisterGamepadBenchmarks
+(
+    BenchmarkRunner&    runner
+)
+{
+    runner.Register( "BM_AnalogAxisGetAxisValue", BM_AnalogAxisGetAxisValue );
+    runner.Register( "BM_TeleopControlGetAxisValue", BM_TeleopControlGetAxisValue );
+}
@@ -0,0 +1,70 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// HardwareBenchmarks.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Times the motor controller calls made every loop.
+///
+//========================================================================================================
+
+// C++ Includes
+
+// FRC includes
+
+// Team 302 includes
+#include <BenchmarkRunner.h>
+#include <RobotBenchmarks.h>
+#include <controllers/ControlModes.h>
+#include <hw/DragonTalon.h>
+#include <hw/usages/MotorControllerUsage.h>
+
+// Third Party Includes
+
+
+namespace
+{
+    // CAN id that isn't used in robot.xml so this doesn't fight with the robot's motors
+    constexpr int BENCHMARK_TALON_ID = 40;
+
+    void BM_DragonTalonSet
+    (
+        BenchmarkState&     state
+    )
+    {
+        static DragonTalon talon( MotorControllerUsage::MOTOR_CONTROLLER_USAGE::ARM, BENCHMARK_TALON_ID, 0, 4096, 1.0 );
+        talon.SetControlMode( ControlModes::CONTROL_TYPE::PERCENT_OUTPUT );
+
+        auto value = 0.0;
+        while ( state.KeepRunning() )
+        {
+            // change the value every call so nothing can skip the write
+            value = value > 0.5 ? 0.0 : value + 0.01;
+            talon.Set( value );
+        }
+    }
+}
+
+void RegisterHardwareBenchmarks
+(
+    BenchmarkRunner&    runner
+)
+{
+    runner.Register( "BM_DragonTalonSet", BM_DragonTalonSet );
+}
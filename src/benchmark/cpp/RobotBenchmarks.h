@@ -0,0 +1,52 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// RobotBenchmarks.h
+//========================================================================================================
+///
+/// File Description:
+///     Registration functions for the robot benchmarks and the simulated hardware setup they share.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+
+// FRC includes
+
+// Team 302 includes
+#include <BenchmarkRunner.h>
+
+// Third Party Includes
+
+
+void RegisterXmlBenchmarks( BenchmarkRunner& runner );
+void RegisterGamepadBenchmarks( BenchmarkRunner& runner );
+void RegisterHardwareBenchmarks( BenchmarkRunner& runner );
+void RegisterStateBenchmarks( BenchmarkRunner& runner );
+void RegisterTrajectoryBenchmarks( BenchmarkRunner& runner );
+
+/// @brief parse robot.xml (RobotDefn::ParseXML) the first time it is called; the hardware can only
+///        be created once, so every benchmark that needs it shares this one robot
+/// @returns bool true if robot.xml was found
+bool BuildRobot();
+
+/// @brief make the simulated driver station report an xbox controller with its sticks pushed on port 0;
+///        called at startup before anything creates TeleopControl
+void SimulateXboxController();
@@ -0,0 +1,88 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// TrajectoryBenchmarks.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Times sampling the PathWeaver trajectories DrivePath follows.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <exception>
+#include <string>
+
+// FRC includes
+#include <frc/Filesystem.h>
+#include <frc/trajectory/Trajectory.h>
+#include <frc/trajectory/TrajectoryUtil.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <BenchmarkRunner.h>
+#include <RobotBenchmarks.h>
+
+// Third Party Includes
+
+using namespace frc;
+using namespace std;
+
+namespace
+{
+    const string PATH_FILE = string("/paths/curveRight.wpilib.json");
+
+    /// DrivePath::CalcCurrentAndDesiredStates is private and needs a chassis; its work each loop is
+    /// this sample at the current path time, so time that directly
+    void BM_TrajectorySample
+    (
+        BenchmarkState&     state
+    )
+    {
+        Trajectory trajectory;
+        try
+        {
+            trajectory = TrajectoryUtil::FromPathweaverJson( filesystem::GetDeployDirectory() + PATH_FILE );
+        }
+        catch ( const exception& e )
+        {
+            state.SkipWithError( string("unable to load ") + PATH_FILE + ": " + e.what() );
+        }
+
+        // walk through the path one loop at a time like DrivePath does
+        auto totalTime  = trajectory.TotalTime();
+        auto sampleTime = units::second_t( 0.0 );
+        while ( state.KeepRunning() )
+        {
+            BenchmarkState::DoNotOptimize( trajectory.Sample( sampleTime ) );
+            sampleTime += units::second_t( 0.02 );
+            if ( sampleTime > totalTime )
+            {
+                sampleTime = units::second_t( 0.0 );
+            }
+        }
+    }
+}
+
+void RegisterTrajectoryBenchmarks
+(
+    BenchmarkRunner&    runner
+)
+{
+    runner.Register( "BM_TrajectorySample", BM_TrajectorySample );
+}
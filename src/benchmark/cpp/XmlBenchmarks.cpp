@@ -0,0 +1,144 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// XmlBenchmarks.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Times parsing the robot definition and auton scripts.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <fstream>
+#include <string>
+
+// FRC includes
+#include <frc/Filesystem.h>
+#include <wpi/fs.h>
+
+// Team 302 includes
+#include <BenchmarkRunner.h>
+#include <RobotBenchmarks.h>
+#include <auton/AutonProgram.h>
+#include <auton/PrimitiveParams.h>
+#include <auton/PrimitiveParser.h>
+#include <xmlhw/RobotDefn.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    const string AUTON_FILE        = string("timedauto.xml");
+
+    /// @brief robot.xml in the deploy directory (src/main/deploy on the desktop), which RobotDefn falls back to
+    string RobotXmlFile()
+    {
+        return frc::filesystem::GetDeployDirectory() + string("/robot.xml");
+    }
+
+    /// @brief the auton scripts sit next to the deploy tree in src/main/autonxml; passed to the
+    ///        parser as a path, the same way the auton simulator does
+    string AutonDirectory()
+    {
+        return fs::path( frc::filesystem::GetDeployDirectory() ).parent_path().string() + string("/autonxml/");
+    }
+
+    bool robotBuilt = false;
+    bool robotFound = false;
+
+    bool FileExists
+    (
+        const string&   fileName
+    )
+    {
+        ifstream file( fileName );
+        return file.good();
+    }
+
+    void ParseRobot()
+    {
+        robotBuilt = true;
+        robotFound = FileExists( RobotXmlFile() );
+        if ( robotFound )
+        {
+            RobotDefn defn;
+            defn.ParseXML();
+        }
+    }
+
+    void BM_RobotDefnParseXML
+    (
+        BenchmarkState&     state
+    )
+    {
+        if ( robotBuilt )
+        {
+            state.SkipWithError( "robot was already built" );
+        }
+        while ( state.KeepRunning() )
+        {
+            ParseRobot();
+        }
+        if ( !robotFound )
+        {
+            state.SkipWithError( RobotXmlFile() + " not found" );
+        }
+    }
+
+    void BM_PrimitiveParserParseXML
+    (
+        BenchmarkState&     state
+    )
+    {
+        auto autonFile = AutonDirectory() + AUTON_FILE;
+        if ( !FileExists( autonFile ) )
+        {
+            state.SkipWithError( autonFile + " not found" );
+        }
+        // reparse into the same program like CyclePrimitives does
+        AutonProgram program;
+        while ( state.KeepRunning() )
+        {
+            BenchmarkState::DoNotOptimize( PrimitiveParser::ParseXML( autonFile, program ) );
+        }
+    }
+}
+
+/// @brief parse robot.xml the first time it is called
+/// @returns bool true if robot.xml was found
+bool BuildRobot()
+{
+    if ( !robotBuilt )
+    {
+        ParseRobot();
+    }
+    return robotFound;
+}
+
+void RegisterXmlBenchmarks
+(
+    BenchmarkRunner&    runner
+)
+{
+    // the hardware can only be created once, so this is a single cold run
+    runner.Register( "BM_RobotDefnParseXML", BM_RobotDefnParseXML, 1 );
+    runner.Register( "BM_PrimitiveParserParseXML", BM_PrimitiveParserParseXML );
+}
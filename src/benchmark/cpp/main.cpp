@@ -0,0 +1,60 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// main.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Desktop benchmark runner for the robot's hot paths.  Uses the simulated HAL, so it runs
+///     without a roboRIO:  ./gradlew frcUserProgramBenchmarkExecutable, then run the executable with
+///     --benchmark_out=results.json to save results to compare between commits.  The XML benchmarks
+///     read robot.xml and the state files from src/main/deploy and the auton scripts from
+///     src/main/autonxml, so run the executable from the repository root.
+///
+//========================================================================================================
+
+// C++ Includes
+
+// FRC includes
+#include <hal/HAL.h>
+
+// Team 302 includes
+#include <BenchmarkRunner.h>
+#include <RobotBenchmarks.h>
+
+// Third Party Includes
+
+
+int main( int argc, char** argv ) 
+{
+    HAL_Initialize( 500, 0 );
+
+    // TeleopControl looks for its controllers when it is created, so plug one in first
+    SimulateXboxController();
+
+    BenchmarkRunner runner( argc, argv );
+
+    // RobotDefn first since it builds the hardware the state benchmarks use
+    RegisterXmlBenchmarks( runner );
+    RegisterGamepadBenchmarks( runner );
+    RegisterHardwareBenchmarks( runner );
+    RegisterStateBenchmarks( runner );
+    RegisterTrajectoryBenchmarks( runner );
+
+    return runner.Run();
+}
@@ -18,6 +18,12 @@
 #include <subsys/interfaces/IChassis.h>
 #include <subsys/MechanismFactory.h>
 #include <auton/CyclePrimitives.h>
+#include <auton/TrajectoryCache.h>
+#include <auton/TrajectoryGeneratorService.h>
+#include <utils/LoopProfiler.h>
+#include <hw/CanBusScheduler.h>
+#include <hw/factories/DragonMotorControllerFactory.h>
+#include <utils/Logger.h>
 
 void Robot::RobotInit() 
 {
@@ -31,8 +37,22 @@ void Robot::RobotInit()
   m_controller->SetDeadBand(TeleopControl::FUNCTION_IDENTIFIER::ARCADE_STEER, IDragonGamePad::AXIS_DEADBAND::APPLY_STANDARD_DEADBAND);
   m_controller->SetAxisProfile(TeleopControl::FUNCTION_IDENTIFIER::ARCADE_THROTTLE, IDragonGamePad::AXIS_PROFILE::CUBED);
   m_controller->SetDeadBand(TeleopControl::FUNCTION_IDENTIFIER::ARCADE_THROTTLE, IDragonGamePad::AXIS_DEADBAND::APPLY_STANDARD_DEADBAND);
+  m_controller->SetAxisProfile(TeleopControl::FUNCTION_IDENTIFIER::ARCADE_STRAFE, IDragonGamePad::AXIS_PROFILE::CUBED);
+  m_controller->SetDeadBand(TeleopControl::FUNCTION_IDENTIFIER::ARCADE_STRAFE, IDragonGamePad::AXIS_DEADBAND::APPLY_STANDARD_DEADBAND);
   auto factory = ChassisFactory::GetChassisFactory();
   m_chassis = factory->GetIChassis();
+  m_poseEstimator = m_chassis != nullptr ? VisionPoseEstimator::GetInstance() : nullptr;
+  if (m_poseEstimator != nullptr)
+  {
+    // center of the power port's outer goal in PathWeaver field coordinates
+    m_poseEstimator->SetTargetPose(frc::Pose2d(15.98_m, 2.404_m, frc::Rotation2d(180_deg)));
+  }
+
+  // the auton preload thread submits generated paths to this service, so create it here rather than there
+  TrajectoryGeneratorService::GetInstance();
+
+  // parse the auton paths now instead of in the first autonomous loops
+  TrajectoryCache::GetInstance()->Preload();
   
   auto mechFactory = MechanismFactory::GetMechanismFactory();
   m_arm = mechFactory->GetArm();
@@ -48,6 +68,8 @@ void Robot::RobotInit()
   m_cyclePrims = new CyclePrimitives();
 
   m_timer = new frc::Timer();
+
+  LoopProfiler::GetInstance()->SetEnabled(true);
 }
 
 /**
@@ -60,10 +82,18 @@ void Robot::RobotInit()
  */
 void Robot::RobotPeriodic() 
 {
+  CanBusScheduler::GetInstance()->Periodic();
+
   if (m_chassis != nullptr)
   {
+    ScopedPhaseTimer timer(LoopProfiler::PHASE::POSE_UPDATE);
     m_chassis->UpdatePose();
   }
+  if (m_poseEstimator != nullptr)
+  {
+    m_poseEstimator->Update();
+  }
+  LoopProfiler::GetInstance()->Periodic();
 }
 
 /**
@@ -79,17 +109,19 @@ void Robot::RobotPeriodic()
  */
 void Robot::AutonomousInit() 
 {
-  // if (m_cyclePrims != nullptr)
-  // {
-  //   m_cyclePrims->Init();
-  // }
+  Logger::GetLogger()->StartMatchLog();
+  if (m_cyclePrims != nullptr)
+  {
+    m_cyclePrims->Init();   // swaps in the plan preloaded in DisabledPeriodic
+  }
 }
 
 void Robot::AutonomousPeriodic() 
 {
-  // if (m_cyclePrims != nullptr)
-  // {
-  //   m_cyclePrims->Run();
+  RefreshSensors();
+  if (m_cyclePrims != nullptr)
+  {
+    m_cyclePrims->Run();
 
 
   //   /**
@@ -103,22 +135,40 @@ void Robot::AutonomousPeriodic()
   //   }
   //   m_chassis->Drive(speeds);
   //   **/
-  //}
+  }
 }
 
 void Robot::TeleopInit() 
 {
+  Logger::GetLogger()->StartMatchLog();
+  m_matchOver = true;
+
   m_speedChooser.SetDefaultOption("Slow", DRIVE_SPEED::SLOW);
   m_speedChooser.AddOption("Light Speed", DRIVE_SPEED::LIGHT_SPEED);
   m_speedChooser.AddOption("Ridiculous Speed", DRIVE_SPEED::RIDICULOUS_SPEED);
   m_speedChooser.AddOption("Ludirous Speed", DRIVE_SPEED::LUDICROUS_SPEED);
   frc::SmartDashboard::PutData("SpeedChooser", &m_speedChooser);
+
+  // the mechanisms pick up the buttons already held (or not) when teleop starts
+  if (m_controller != nullptr)
+  {
+    m_controller->ResetInputEvents();
+  }
 }
 
 void Robot::TeleopPeriodic() 
 {
+  RefreshSensors();
+
+  // sample the subscribed buttons once; the state managers only check transitions on their events
+  if (m_controller != nullptr)
+  {
+    m_controller->Update();
+  }
+
   if (m_chassis != nullptr && m_controller != nullptr)
   {
+    ScopedPhaseTimer timer(LoopProfiler::PHASE::CHASSIS);
     double speedMultiplier = 0.0;
     switch (m_speedChooser.GetSelected())
     {
@@ -141,39 +191,85 @@ void Robot::TeleopPeriodic()
     speeds.vx = throttle * m_chassis->GetMaxSpeed()*speedMultiplier;
     speeds.vy = 0_mps; //units::velocity::meters_per_second_t(0)
     speeds.omega = steer * m_chassis->GetMaxAngularSpeed()*speedMultiplier;
-    m_chassis->Drive(speeds);
+    if (m_chassis->IsHolonomic())
+    {
+      // stick left is field left
+      auto strafe = m_controller->GetAxisValue(TeleopControl::FUNCTION_IDENTIFIER::ARCADE_STRAFE)*-1;
+      speeds.vy = strafe * m_chassis->GetMaxSpeed()*speedMultiplier;
+      m_chassis->DriveFieldOriented(speeds);
+    }
+    else
+    {
+      m_chassis->Drive(speeds);
+    }
   }
 
   if (m_intake != nullptr && m_intakeStateMgr != nullptr)
   {
+    ScopedPhaseTimer timer(LoopProfiler::PHASE::INTAKE);
     m_intakeStateMgr->RunCurrentState();
   }
 
   if (m_ballTransfer != nullptr && m_ballTransferStateMgr != nullptr)
   {
+    ScopedPhaseTimer timer(LoopProfiler::PHASE::TRANSFER);
     m_ballTransferStateMgr->RunCurrentState();
   }
 
   if (m_arm != nullptr && m_armStateMgr != nullptr)
   {
+    ScopedPhaseTimer timer(LoopProfiler::PHASE::ARM);
     m_armStateMgr->RunCurrentState();
   }
 
   if (m_ballRelease != nullptr && m_ballReleaseStateMgr != nullptr )
   {
+    ScopedPhaseTimer timer(LoopProfiler::PHASE::RELEASE);
     m_ballReleaseStateMgr->RunCurrentState();
   }
 }
 
-void Robot::DisabledInit() {}
+void Robot::DisabledInit() 
+{
+  // close the match log once teleop is over; the disable between auton and teleop keeps it open
+  if (m_matchOver)
+  {
+    Logger::GetLogger()->EndMatchLog();
+    m_matchOver = false;
+  }
 
-void Robot::DisabledPeriodic() {}
+  // pick up any paths that failed to load at boot
+  TrajectoryCache::GetInstance()->Preload();
+}
 
-void Robot::TestInit() {}
+void Robot::DisabledPeriodic() 
+{
+  RefreshSensors();
+
+  // have the selected auton parsed and checked before the match starts
+  if (m_cyclePrims != nullptr)
+  {
+    m_cyclePrims->PreloadSelected();
+  }
+}
+
+void Robot::TestInit() 
+{
+  Logger::GetLogger()->StartMatchLog();
+  m_matchOver = true;
+}
 
 void Robot::TestPeriodic() 
 {
+  RefreshSensors();
+}
 
+/// @brief sample the motor controller sensors once, first thing in the loop; the mode periodic 
+///        code and the pose update in RobotPeriodic all see this loop's values
+void Robot::RefreshSensors()
+{
+  ScopedPhaseTimer timer(LoopProfiler::PHASE::SENSOR_REFRESH);
+  DragonMotorControllerFactory::GetInstance()->RefreshSensors();
 }
 
 #ifndef RUNNING_FRC_TESTS
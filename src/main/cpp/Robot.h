@@ -19,6 +19,7 @@
 #include <subsys/BallRelease.h>
 #include <subsys/BallTransfer.h>
 #include <subsys/Intake.h>
+#include <subsys/VisionPoseEstimator.h>
 #include <auton/CyclePrimitives.h>
 
 
@@ -36,8 +37,11 @@ class Robot : public frc::TimedRobot {
   void TestPeriodic() override;
 
  private:
+  void RefreshSensors();
+
   TeleopControl*        m_controller;
   IChassis*             m_chassis;
+  VisionPoseEstimator*  m_poseEstimator;
   frc::Timer*           m_timer;
 
   ArmStateMgr*          m_armStateMgr;
@@ -50,6 +54,7 @@ class Robot : public frc::TimedRobot {
   BallTransfer*         m_ballTransfer;
   Intake*               m_intake;
   CyclePrimitives*      m_cyclePrims;
+  bool                  m_matchOver = false;   // teleop or test ran, so the next disable ends the match log
 
   enum DRIVE_SPEED
   {
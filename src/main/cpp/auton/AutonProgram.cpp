@@ -0,0 +1,123 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// AutonProgram.cpp
+//========================================================================================================
+///
+/// File Description:
+///     A parsed auton script held in contiguous, reusable storage.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <string>
+#include <type_traits>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/AutonProgram.h>
+#include <auton/PrimitiveParams.h>
+
+// Third Party Includes
+
+using namespace std;
+
+static_assert( is_trivially_copyable<PrimitiveParams>::value, "PrimitiveParams must stay a plain record" );
+
+AutonProgram::AutonProgram() : m_fileName(),
+                               m_primitives(),
+                               m_pathNames(),
+                               m_pathCount( 0 ),
+                               m_generatedPaths()
+{
+}
+
+void AutonProgram::Clear
+(
+    const string&                           fileName
+)
+{
+    m_fileName = fileName;
+    m_primitives.clear();
+    m_pathCount = 0;            // the names are overwritten in place so their buffers get reused
+    m_generatedPaths.clear();   // drops the generated paths; the worker may still be finishing them
+}
+
+void AutonProgram::Add
+(
+    const PrimitiveParams&                  primitive,
+    TrajectoryGeneratorService::PathFuture  generatedPath
+)
+{
+    m_primitives.emplace_back( primitive );
+    auto& added = m_primitives.back();
+    added.m_program = this;
+    added.m_generatedPathIndex = PrimitiveParams::NO_INDEX;
+    if ( generatedPath.valid() )
+    {
+        added.m_generatedPathIndex = static_cast<int>( m_generatedPaths.size() );
+        m_generatedPaths.emplace_back( generatedPath );
+    }
+}
+
+int AutonProgram::InternPath
+(
+    const string&                           pathName
+)
+{
+    if ( pathName.empty() )
+    {
+        return PrimitiveParams::NO_INDEX;
+    }
+
+    // scripts use a handful of paths, so a linear search is plenty
+    for ( size_t inx=0; inx<m_pathCount; ++inx )
+    {
+        if ( m_pathNames[inx] == pathName )
+        {
+            return static_cast<int>( inx );
+        }
+    }
+
+    if ( m_pathCount < m_pathNames.size() )
+    {
+        m_pathNames[m_pathCount].assign( pathName );
+    }
+    else
+    {
+        m_pathNames.emplace_back( pathName );
+    }
+    return static_cast<int>( m_pathCount++ );
+}
+
+const string& AutonProgram::GetPathName
+(
+    int                                     index
+) const
+{
+    static const string noPath;
+    return ( index >= 0 && static_cast<size_t>( index ) < m_pathCount ) ? m_pathNames[index] : noPath;
+}
+
+TrajectoryGeneratorService::PathFuture AutonProgram::GetGeneratedPath
+(
+    int                                     index
+) const
+{
+    return ( index >= 0 && static_cast<size_t>( index ) < m_generatedPaths.size() ) ? m_generatedPaths[index] : TrajectoryGeneratorService::PathFuture();
+}
@@ -0,0 +1,103 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// AutonProgram.h
+//========================================================================================================
+///
+/// File Description:
+///     A parsed auton script: its primitives in one contiguous vector of PrimitiveParams records,
+///     plus the path names they use (each stored once) and the paths being generated for them.
+///     Clear() keeps the storage, so parsing the next script into the same program doesn't
+///     allocate once it has grown to the largest script.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/PrimitiveParams.h>
+#include <auton/TrajectoryGeneratorService.h>
+
+// Third Party Includes
+
+
+class AutonProgram
+{
+    public:
+        AutonProgram();
+        ~AutonProgram() = default;
+
+        // the records point back at their program, so it can't be copied or moved
+        AutonProgram( const AutonProgram& ) = delete;
+        AutonProgram& operator=( const AutonProgram& ) = delete;
+
+        /// @brief empty the program for the next script, keeping its storage
+        /// @param [in] const std::string& fileName - script that will be parsed into it
+        void Clear
+        (
+            const std::string&                      fileName
+        );
+
+        /// @brief add a primitive to the end of the program
+        /// @param [in] const PrimitiveParams& primitive - record to copy in
+        /// @param [in] PathFuture generatedPath - path generated for it (not valid if it has none)
+        void Add
+        (
+            const PrimitiveParams&                  primitive,
+            TrajectoryGeneratorService::PathFuture  generatedPath
+        );
+
+        /// @brief index of a path name, adding it to the program if it isn't there yet
+        /// @param [in] const std::string& pathName - name to look up (empty for none)
+        /// @return int - index to give PrimitiveParams (PrimitiveParams::NO_INDEX for an empty name)
+        int InternPath
+        (
+            const std::string&                      pathName
+        );
+
+        inline const std::string& GetFileName() const { return m_fileName; }
+        inline size_t GetSize() const { return m_primitives.size(); }
+        inline bool IsEmpty() const { return m_primitives.empty(); }
+        inline PrimitiveParams* GetPrimitive( size_t index ) { return &m_primitives[index]; }
+        inline const PrimitiveParams* GetPrimitive( size_t index ) const { return &m_primitives[index]; }
+
+        /// @brief path name by index (empty for PrimitiveParams::NO_INDEX)
+        const std::string& GetPathName
+        (
+            int                                     index
+        ) const;
+
+        /// @brief generated path by index (not valid for PrimitiveParams::NO_INDEX)
+        TrajectoryGeneratorService::PathFuture GetGeneratedPath
+        (
+            int                                     index
+        ) const;
+
+    private:
+        std::string                                             m_fileName;
+        std::vector<PrimitiveParams>                            m_primitives;
+        std::vector<std::string>                                m_pathNames;        // only the first m_pathCount are in use
+        size_t                                                  m_pathCount;
+        std::vector<TrajectoryGeneratorService::PathFuture>     m_generatedPaths;
+};
@@ -15,25 +15,35 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <string>
 #include <memory>
 #include <iostream>
+#include <set>
 
 // FRC includes
 #include <frc/Timer.h>
 #include <frc/DriverStation.h>
+#include <frc/kinematics/ChassisSpeeds.h>
 
 // Team 302 includes
 #include <auton/primitives/IPrimitive.h>
 #include <auton/CyclePrimitives.h>
 #include <auton/PrimitiveFactory.h>
+#include <auton/AutonProgram.h>
 #include <auton/AutonSelector.h>
 #include <auton/PrimitiveEnums.h>
 #include <frc/SmartDashboard/SmartDashboard.h>
 #include <auton/PrimitiveParser.h>
 #include <auton/PrimitiveParams.h>
+#include <auton/TrajectoryCache.h>
+#include <auton/TrajectoryGeneratorService.h>
+#include <subsys/ChassisFactory.h>
 #include <subsys/MechanismFactory.h>
 #include <utils/Logger.h>
+#include <utils/LoopProfiler.h>
 #include <states/arm/ArmStateMgr.h>
 #include <states/ballrelease/BallReleaseStateMgr.h>
 #include <states/balltransfer/BallTransferStateMgr.h>
@@ -44,9 +54,10 @@
 using namespace frc;
 using namespace std;
 
-CyclePrimitives::CyclePrimitives() : m_primParams(), 
+CyclePrimitives::CyclePrimitives() : m_program( make_unique<AutonProgram>() ), 
 									 m_currentPrimSlot(0), 
-								     m_currentPrim(nullptr), 
+									 m_activePrims(),
+									 m_activeGroupMode(PRIMITIVE_GROUP::SEQUENTIAL),
 									 m_primFactory(
 									 PrimitiveFactory::GetInstance()), 
 									 m_doNothing(nullptr), 
@@ -61,54 +72,202 @@ CyclePrimitives::CyclePrimitives() : m_primParams(),
 									 m_currIntakeState(IntakeStateMgr::INTAKE_STATE::OFF),
 									 m_currTransferState(BallTransferStateMgr::BALL_TRANSFER_STATE::OFF),
 									 m_currArmState(ArmStateMgr::ARM_STATE::HOLD_POSITION),
-									 m_currReleaseState(BallReleaseStateMgr::BALL_RELEASE_STATE::HOLD)
+									 m_currReleaseState(BallReleaseStateMgr::BALL_RELEASE_STATE::HOLD),
+									 m_pendingProgram( make_unique<AutonProgram>() ),
+									 m_pendingParse(),
+									 m_pendingFile(),
+									 m_readyProgram( make_unique<AutonProgram>() )
 {
 }
 
 void CyclePrimitives::Init()
+{
+	Start( m_autonSelector->GetSelectedAutoFile() );
+}
+
+void CyclePrimitives::Start
+(
+	const string&					autonFile
+)
 {
 	m_currentPrimSlot = 0; //Reset current prim
-	m_primParams.clear();
+	m_activePrims.clear();
+	m_isDone = false;
 
-	m_primParams = PrimitiveParser::ParseXML( m_autonSelector->GetSelectedAutoFile() );
-	if (!m_primParams.empty())
+	if ( !m_readyProgram->IsEmpty() && m_readyProgram->GetFileName() == autonFile )
 	{
-		GetNextPrim();
+		m_program.swap( m_readyProgram );		// parsed and validated while disabled
+		m_readyProgram->Clear( string() );		// the last run's program; reused by the next preload
 	}
-}
-
-void CyclePrimitives::Run()
-{
-	if (m_currentPrim != nullptr)
+	else
 	{
-		m_currentPrim->Run();
-		if(m_intake != nullptr)
+		auto parsed = false;
+		if ( m_pendingParse.valid() && m_pendingFile == autonFile )
 		{
-			m_intake->SetCurrentState(m_currIntakeState, true);
+			parsed = m_pendingParse.get();		// enabled mid parse; finishing it is still quicker than starting over
+			m_program.swap( m_pendingProgram );
 		}
-		if(m_transfer != nullptr)
+		else
 		{
-			m_transfer->SetCurrentState(m_currTransferState, true);
+			Logger::GetLogger()->LogError( string("CyclePrimitives::Start"), string("auton wasn't preloaded: ") + autonFile );
+			parsed = PrimitiveParser::ParseXML( autonFile, *m_program );
 		}
-		if(m_arm != nullptr)
+
+		// PreloadSelected didn't get to validate this one; it still runs, like a preloaded plan with errors
+		string error;
+		if ( !ValidatePlan( *m_program, parsed, error ) )
 		{
-			m_arm->SetCurrentState(m_currArmState, true);
+			Logger::GetLogger()->LogError( string("CyclePrimitives::Start"), error );
 		}
-		if(m_release != nullptr)
+	}
+	ShowPlanStatus( false, string("running ") + autonFile );
+
+	if (!m_program->IsEmpty())
+	{
+		GetNextPrim();
+	}
+}
+
+void CyclePrimitives::Run()
+{
+	if (!m_activePrims.empty())
+	{
+		ScopedPhaseTimer timer(LoopProfiler::PHASE::AUTON_PRIMITIVE);
+
+		RunStep();
+
+		// start the next step in the loop this one finishes, so the chassis is never left a loop without a
+		// command; steps that finish on their first run (e.g. RESET_POSITION) chain on in the same loop
+		while ( !m_activePrims.empty() && IsStepDone() )
 		{
-			m_release->SetCurrentState(m_currReleaseState, true);
+			GetNextPrim();
+			if ( !m_activePrims.empty() )
+			{
+				RunStep();
+			}
 		}
 	}
 	else
 	{
 		Logger::GetLogger()->LogError(string("CyclePrimitive"), string("Completed"));
 		m_isDone = true;
-		m_primParams.clear();	// clear the primitive params vector
+		m_program->Clear( string() );	// keeps its storage for the next script
 		m_currentPrimSlot = 0;  //Reset current prim slot
 		RunDoNothing();
 	}
 }
 
+void CyclePrimitives::RunStep()
+{
+	// set the mechanism states first, so a primitive waiting on them checks this loop's targets
+	if(m_intake != nullptr)
+	{
+		m_intake->SetCurrentState(m_currIntakeState, true);
+	}
+	if(m_transfer != nullptr)
+	{
+		m_transfer->SetCurrentState(m_currTransferState, true);
+	}
+	if(m_arm != nullptr)
+	{
+		m_arm->SetCurrentState(m_currArmState, true);
+	}
+	if(m_release != nullptr)
+	{
+		m_release->SetCurrentState(m_currReleaseState, true);
+	}
+
+	// a primitive may only blend into the next step if it is the whole step and the next step takes over
+	// the chassis; otherwise the chassis would keep the blending primitive's last setpoint with nothing driving it
+	auto canBlend = m_activePrims.size() == 1 && StepDriver( *m_program, m_currentPrimSlot ) != nullptr;
+	for ( auto& active : m_activePrims )
+	{
+		if ( !active.done )
+		{
+			active.primitive->Run();
+			if ( canBlend && active.primitive->InBlendWindow() )
+			{
+				active.done = true;		// the next primitive takes over the chassis this loop
+			}
+			else if ( active.primitive->IsDone() )
+			{
+				FinishPrimitive( active );
+			}
+		}
+	}
+
+	auto timedOut = !IsStepDone() && m_timer->HasElapsed( units::second_t(m_maxTime) );
+	if ( timedOut )
+	{
+		Logger::GetLogger()->LogError( string("CyclePrimitives::RunStep"), string("timed out before primitive ") + to_string( m_currentPrimSlot ) );
+	}
+
+	// a race or deadline step, or a timeout, ends the members that are still running
+	if ( timedOut || IsStepDone() )
+	{
+		for ( auto& active : m_activePrims )
+		{
+			if ( !active.done )
+			{
+				FinishPrimitive( active );
+			}
+		}
+	}
+}
+
+/// @brief mark a member of the step done; if it was driving, stop the chassis rather than leaving its last setpoint running
+void CyclePrimitives::FinishPrimitive
+(
+	ActivePrimitive&	active
+)
+{
+	active.done = true;
+	if ( DrivesChassis( active.params ) )
+	{
+		auto chassis = ChassisFactory::GetChassisFactory()->GetIChassis();
+		if ( chassis != nullptr )
+		{
+			ChassisSpeeds speeds;
+			speeds.vx = 0_mps;
+			speeds.vy = 0_mps;
+			speeds.omega = units::degrees_per_second_t(0.0);
+			chassis->Drive( speeds );
+		}
+	}
+}
+
+/// @brief true if the primitive commands the chassis
+bool CyclePrimitives::DrivesChassis
+(
+	const PrimitiveParams*	params
+)
+{
+	return params->GetID() != WAIT_FOR_MECHANISMS && params->GetID() != RESET_POSITION;
+}
+
+/// @brief the member of the step starting at slot that commands the chassis (nullptr if none does)
+const PrimitiveParams* CyclePrimitives::StepDriver
+(
+	const AutonProgram&		program,
+	unsigned int			slot
+)
+{
+	auto groupID = slot < program.GetSize() ? program.GetPrimitive( slot )->GetGroupID() : 0;
+	for ( auto inx=slot; inx<program.GetSize(); ++inx )
+	{
+		auto params = program.GetPrimitive( inx );
+		if ( inx > slot && ( groupID == 0 || params->GetGroupID() != groupID ) )
+		{
+			break;
+		}
+		if ( DrivesChassis( params ) )
+		{
+			return params;
+		}
+	}
+	return nullptr;
+}
+
 bool CyclePrimitives::AtTarget() const
 {
 	return m_isDone;
@@ -116,22 +275,70 @@ bool CyclePrimitives::AtTarget() const
 
 void CyclePrimitives::GetNextPrim()
 {
-	PrimitiveParams* currentPrimParam = (m_currentPrimSlot < (int) m_primParams.size()) ? m_primParams[m_currentPrimSlot] : nullptr;
+	m_activePrims.clear();
+	m_activeGroupMode = PRIMITIVE_GROUP::SEQUENTIAL;
 
-	m_currentPrim = (currentPrimParam != nullptr) ? m_primFactory->GetIPrimitive(currentPrimParam) : nullptr;
-	if (m_currentPrim != nullptr)
+	// a primitive runs by itself; the members of a group are consecutive and share its id
+	auto startSlot = m_currentPrimSlot;
+	auto groupID = 0;
+	while (m_currentPrimSlot < (int) m_program->GetSize())
 	{
-		m_currentPrim->Init(currentPrimParam);
-		m_maxTime = currentPrimParam->GetTime();
-		m_timer->Reset();
-		m_timer->Start();
+		PrimitiveParams* currentPrimParam = m_program->GetPrimitive(m_currentPrimSlot);
+		if ( m_currentPrimSlot > startSlot && ( groupID == 0 || currentPrimParam->GetGroupID() != groupID ) )
+		{
+			break;
+		}
+		groupID = currentPrimParam->GetGroupID();
+		m_activeGroupMode = currentPrimParam->GetGroupMode();
+		m_currentPrimSlot++;
+
+		auto primitive = m_primFactory->GetIPrimitive(currentPrimParam);
+		if (primitive == nullptr)
+		{
+			Logger::GetLogger()->LogError(string("CyclePrimitives::GetNextPrim"), string("unsupported primitive ") + to_string(currentPrimParam->GetID()));
+			continue;
+		}
+		auto sameObject = [primitive]( const ActivePrimitive& active ) { return active.primitive == primitive; };
+		if ( find_if( m_activePrims.begin(), m_activePrims.end(), sameObject ) != m_activePrims.end() )
+		{
+			// the factory has one object per primitive id, so it can't run twice in a group
+			Logger::GetLogger()->LogError(string("CyclePrimitives::GetNextPrim"), string("group repeats primitive ") + to_string(currentPrimParam->GetID()));
+			continue;
+		}
+
+		primitive->Init(currentPrimParam);
+		m_activePrims.emplace_back( ActivePrimitive{ primitive, currentPrimParam, false } );
+
+		// mechanism attributes carry over between primitives, so the last member's states are the group's
 		m_currIntakeState = currentPrimParam->GetIntakeState();
 		m_currTransferState = currentPrimParam->GetTransferState();
 		m_currArmState = currentPrimParam->GetArmState();
 		m_currReleaseState = currentPrimParam->GetReleaseState();
 	}
 
-	m_currentPrimSlot++;
+	// the step times out after the longest time given to its primitives
+	m_maxTime = 0.0;
+	for ( auto& active : m_activePrims )
+	{
+		m_maxTime = max( m_maxTime, (double) active.params->GetTime() );
+	}
+	m_timer->Reset();
+	m_timer->Start();
+}
+
+bool CyclePrimitives::IsStepDone() const
+{
+	switch ( m_activeGroupMode )
+	{
+		case PRIMITIVE_GROUP::RACE:
+			return any_of( m_activePrims.begin(), m_activePrims.end(), []( const ActivePrimitive& active ) { return active.done; } );
+
+		case PRIMITIVE_GROUP::DEADLINE:
+			return m_activePrims.front().done;
+
+		default:
+			return all_of( m_activePrims.begin(), m_activePrims.end(), []( const ActivePrimitive& active ) { return active.done; } );
+	}
 }
 
 void CyclePrimitives::RunDoNothing()
@@ -147,7 +354,7 @@ void CyclePrimitives::RunDoNothing()
 		                                   0.0,                 // heading
 		                                   0.0,                 // start drive speed
 		                                   0.0,					// end drive speed
-										  std::string(),
+										  PrimitiveParams::NO_INDEX,
 										  IntakeStateMgr::INTAKE_STATE::OFF,
 										  BallTransferStateMgr::BALL_TRANSFER_STATE::OFF,
 										  ArmStateMgr::ARM_STATE::HOLD_POSITION,
@@ -157,3 +364,170 @@ void CyclePrimitives::RunDoNothing()
 	}
 	m_doNothing->Run();
 }
+
+void CyclePrimitives::PreloadSelected()
+{
+	if ( m_pendingParse.valid() )
+	{
+		if ( m_pendingParse.wait_for( chrono::seconds( 0 ) ) != future_status::ready )
+		{
+			return;
+		}
+
+		auto parsed = m_pendingParse.get();
+		m_readyProgram.swap( m_pendingProgram );
+
+		string error;
+		if ( ValidatePlan( *m_readyProgram, parsed, error ) )
+		{
+			ShowPlanStatus( true, m_readyProgram->GetFileName() + string(" ready") );
+		}
+		else
+		{
+			Logger::GetLogger()->LogError( string("CyclePrimitives::PreloadSelected"), error );
+			ShowPlanStatus( false, error );
+		}
+	}
+
+	// a newer selection is picked up once the parse in flight finishes
+	auto selected = m_autonSelector->GetSelectedAutoFile();
+	if ( selected != m_readyProgram->GetFileName() )
+	{
+		// the worker only touches the pending program; the main thread leaves it alone until the parse is done
+		auto program = m_pendingProgram.get();
+		m_pendingFile = selected;
+		m_pendingParse = async( launch::async, [selected, program] { return PrimitiveParser::ParseXML( selected, *program ); } );
+		ShowPlanStatus( false, string("loading ") + selected );
+	}
+}
+
+bool CyclePrimitives::ValidatePlan
+(
+	AutonProgram&					program,
+	bool							parsed,
+	string&							error
+)
+{
+	if ( !parsed )
+	{
+		error = program.GetFileName() + string(" has parse errors (see the log)");
+		return false;
+	}
+	if ( program.IsEmpty() )
+	{
+		error = program.GetFileName() + string(" has no primitives");
+		return false;
+	}
+
+	auto groupID = 0;
+	set<PRIMITIVE_IDENTIFIER> groupMembers;
+	auto groupDrivers = 0;
+	for ( unsigned int inx=0; inx<program.GetSize(); ++inx )
+	{
+		auto params = program.GetPrimitive( inx );
+		auto slot = program.GetFileName() + string(" primitive ") + to_string( inx ) + string(": ");
+		if ( m_primFactory->GetIPrimitive( params ) == nullptr )
+		{
+			error = slot + string("unsupported id");
+			return false;
+		}
+
+		if ( params->GetGroupID() != groupID )
+		{
+			groupID = params->GetGroupID();
+			groupMembers.clear();
+			groupDrivers = 0;
+		}
+		if ( groupID != 0 )
+		{
+			if ( !groupMembers.insert( params->GetID() ).second )
+			{
+				error = slot + string("group repeats this primitive");
+				return false;
+			}
+			if ( DrivesChassis( params ) && ++groupDrivers > 1 )
+			{
+				error = slot + string("group drives the chassis from more than one primitive");
+				return false;
+			}
+		}
+
+		// the trajectory cache is only used from this thread, so paths are resolved here rather than by the parser
+		const auto& pathName = params->GetPathName();
+		if ( !pathName.empty() && TrajectoryCache::GetInstance()->GetPath( pathName ).get() == nullptr )
+		{
+			error = slot + string("missing path ") + pathName;
+			return false;
+		}
+		if ( params->GetID() == DRIVE_PATH && pathName.empty() && !params->GetGeneratedPath().valid() )
+		{
+			error = slot + string("no pathname or waypoints");
+			return false;
+		}
+
+		if ( params->GetBlendTime() > 0.0 )
+		{
+			if ( ( params->GetID() != DRIVE_PATH && params->GetID() != DRIVE_TIME ) || groupID != 0 )
+			{
+				error = slot + string("blendtime only applies to a DRIVE_PATH or DRIVE_TIME that isn't in a group");
+				return false;
+			}
+			auto next = StepDriver( program, inx + 1 );
+			if ( next == nullptr )
+			{
+				error = slot + string("blendtime needs a next step that drives the chassis");
+				return false;
+			}
+
+			// a path blended into is generated from the blending path's hand off pose; a PathWeaver path
+			// (or one after DRIVE_TIME) would start from its own start pose, away from the robot
+			if ( next->GetID() == DRIVE_PATH &&
+				 ( !next->GetGeneratedPath().valid() || params->GetID() != DRIVE_PATH || !params->GetGeneratedPath().valid() ) )
+			{
+				error = slot + string("only a waypoints DRIVE_PATH can blend into a DRIVE_PATH, and that one needs waypoints too");
+				return false;
+			}
+
+			// the primitive's own duration: its time, or its path when that is known (a generated one may still be generating)
+			auto duration = units::second_t( params->GetTime() );
+			shared_ptr<const TrajectoryCache::CachedPath> path;
+			if ( !pathName.empty() )
+			{
+				path = TrajectoryCache::GetInstance()->GetPath( pathName );
+			}
+			else if ( TrajectoryGeneratorService::IsReady( params->GetGeneratedPath() ) )
+			{
+				path = params->GetGeneratedPath().get();
+			}
+			if ( path.get() != nullptr )
+			{
+				duration = min( duration, path.get()->trajectory.TotalTime() );
+			}
+			if ( units::second_t( params->GetBlendTime() ) >= duration )
+			{
+				error = slot + string("blendtime is as long as the primitive");
+				return false;
+			}
+		}
+
+		if ( ( m_intake != nullptr && !m_intake->IsValidState( params->GetIntakeState() ) ) ||
+			 ( m_transfer != nullptr && !m_transfer->IsValidState( params->GetTransferState() ) ) ||
+			 ( m_arm != nullptr && !m_arm->IsValidState( params->GetArmState() ) ) ||
+			 ( m_release != nullptr && !m_release->IsValidState( params->GetReleaseState() ) ) )
+		{
+			error = slot + string("mechanism state isn't defined");
+			return false;
+		}
+	}
+	return true;
+}
+
+void CyclePrimitives::ShowPlanStatus
+(
+	bool							ready,
+	const string&					status
+) const
+{
+	SmartDashboard::PutBoolean( "Auton Ready", ready );
+	SmartDashboard::PutString( "Auton Status", status );
+}
@@ -17,7 +17,9 @@
 #pragma once
 
 // C++ Includes
+#include <future>
 #include <memory>
+#include <string>
 
 // FRC includes
 #include <frc/Timer.h>
@@ -29,6 +31,9 @@
 
 
 #include <vector>
+#include <auton/AutonProgram.h>
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
 #include <states/IState.h>
 #include <states/arm/ArmStateMgr.h>
 #include <states/ballrelease/BallReleaseStateMgr.h>
@@ -38,7 +43,6 @@
 class AutonSelector;
 class IPrimitive;
 class PrimitiveFactory;
-class PrimitiveParams;
 
 
 class CyclePrimitives : public IState
@@ -48,23 +52,74 @@ class CyclePrimitives : public IState
 		virtual ~CyclePrimitives() = default;
 
 		void Init() override;
+
+		/// @brief start running an auton script (Init starts the one picked on the dashboard)
+		/// @param [in] std::string autonFile - file name under /home/lvuser/auton, or a path to the file
+		void Start
+		(
+			const std::string&				autonFile
+		);
 		void Run() override;
 	 	bool AtTarget() const override;
 
+		/// @brief call while disabled: parses the selected auton script in the background whenever
+		///        the selection changes and validates it, so Init only has to swap the plan in
+		void PreloadSelected();
+
+		/// @brief the script being run and the slot after the primitive (or group) that is running
+		inline const AutonProgram& GetProgram() const { return *m_program; };
+		inline int GetPrimSlot() const { return m_currentPrimSlot; };
 
 	protected:
 		void GetNextPrim();
 		void RunDoNothing();
 
 	private:
-		std::vector<PrimitiveParams*> 	m_primParams;
+		/// @brief a primitive in the step being run
+		struct ActivePrimitive
+		{
+			IPrimitive*					primitive;
+			PrimitiveParams*			params;
+			bool						done;
+		};
+
+		void RunStep();
+		bool IsStepDone() const;
+		void FinishPrimitive
+		(
+			ActivePrimitive&				active
+		);
+		static bool DrivesChassis
+		(
+			const PrimitiveParams*			params
+		);
+		static const PrimitiveParams* StepDriver
+		(
+			const AutonProgram&				program,
+			unsigned int					slot
+		);
+
+		bool ValidatePlan
+		(
+			AutonProgram&					program,
+			bool							parsed,
+			std::string&					error
+		);
+		void ShowPlanStatus
+		(
+			bool							ready,
+			const std::string&				status
+		) const;
+
+		std::unique_ptr<AutonProgram>	m_program;			// script being run
 		int 							m_currentPrimSlot;
-		IPrimitive*						m_currentPrim;
+		std::vector<ActivePrimitive>	m_activePrims;		// the primitive or group being run
+		PRIMITIVE_GROUP					m_activeGroupMode;
 		PrimitiveFactory* 				m_primFactory;
 		IPrimitive* 					m_doNothing;
 		AutonSelector* 					m_autonSelector;
-		std::unique_ptr<frc::Timer>     m_timer;
-		double                          m_maxTime;
+		std::unique_ptr<frc::Timer>     m_timer;			// time in the step being run
+		double                          m_maxTime;			// step's timeout
 		bool							m_isDone;
 		IntakeStateMgr*					m_intake;
 		BallTransferStateMgr*			m_transfer;
@@ -74,5 +129,9 @@ class CyclePrimitives : public IState
 		BallTransferStateMgr::BALL_TRANSFER_STATE m_currTransferState;
 		ArmStateMgr::ARM_STATE			m_currArmState;
 		BallReleaseStateMgr::BALL_RELEASE_STATE m_currReleaseState;
+		std::unique_ptr<AutonProgram>	m_pendingProgram;	// script being parsed while disabled
+		std::future<bool>				m_pendingParse;
+		std::string						m_pendingFile;
+		std::unique_ptr<AutonProgram>	m_readyProgram;		// parsed and validated script
 };
 
@@ -38,7 +38,17 @@
              TURN_ANGLE_REL,
              DRIVE_PATH,
              RESET_POSITION,
+             WAIT_FOR_MECHANISMS,
              MAX_AUTON_PRIMITIVES
          };
 
+       /// @brief how a primitive runs with its neighbours; members of a group share a group id
+       enum PRIMITIVE_GROUP
+         {
+             SEQUENTIAL,        // runs by itself
+             PARALLEL,          // group is done when every member is done
+             RACE,              // group is done when any member is done
+             DEADLINE           // group is done when its first member is done
+         };
+
 
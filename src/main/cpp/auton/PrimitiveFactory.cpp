@@ -20,6 +20,7 @@
 #include <auton/primitives/IPrimitive.h>
 #include <auton/primitives/ResetPosition.h>
 #include <auton/primitives/DrivePath.h>
+#include <auton/primitives/WaitForMechanisms.h>
 
 PrimitiveFactory* PrimitiveFactory::m_instance = nullptr;
 
@@ -39,7 +40,8 @@ PrimitiveFactory::PrimitiveFactory() :
 				m_driveToWall(nullptr),
 				m_driveLidarDistance( nullptr ),
 				m_resetPosition( nullptr ),
-				m_drivePath(nullptr)
+				m_drivePath(nullptr),
+				m_waitForMechanisms(nullptr)
 {
 }
 
@@ -123,6 +125,14 @@ IPrimitive* PrimitiveFactory::GetIPrimitive(PrimitiveParams* primitivePasser)
 		}
 		primitive = m_drivePath;
 		break;
+
+	case WAIT_FOR_MECHANISMS :
+		if (m_waitForMechanisms == nullptr)
+		{
+			m_waitForMechanisms = new WaitForMechanisms();
+		}
+		primitive = m_waitForMechanisms;
+		break;
 		
 	default:
 		break;	
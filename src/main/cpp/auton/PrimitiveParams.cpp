@@ -5,6 +5,9 @@
  *      Author: Jonah Shader
  */
 
+#include <string>
+
+#include <auton/AutonProgram.h>
 #include <auton/PrimitiveEnums.h>
 #include <auton/PrimitiveParams.h>
 #include <states/arm/ArmStateMgr.h>
@@ -22,7 +25,7 @@ PrimitiveParams::PrimitiveParams
     float                       						heading,
     float                       						startDriveSpeed,
     float                       						endDriveSpeed,
-	std::string											pathName,
+	int													pathIndex,
 	IntakeStateMgr::INTAKE_STATE                        intakeState,
 	BallTransferStateMgr::BALL_TRANSFER_STATE           transferState,
 	ArmStateMgr::ARM_STATE                              armState,
@@ -36,11 +39,16 @@ PrimitiveParams::PrimitiveParams
 		m_heading(heading),
 		m_startDriveSpeed( startDriveSpeed ),
 		m_endDriveSpeed( endDriveSpeed ),
-		m_pathName ( pathName),
+		m_pathIndex( pathIndex ),
 		m_intakeState(intakeState),
 		m_transferState(transferState),
 		m_armState(armState),
-		m_releaseState(releaseState)
+		m_releaseState(releaseState),
+		m_generatedPathIndex( NO_INDEX ),
+		m_groupID(0),
+		m_groupMode(PRIMITIVE_GROUP::SEQUENTIAL),
+		m_blendTime(0.0),
+		m_program( nullptr )
 {
 }
 
@@ -84,9 +92,10 @@ float PrimitiveParams::GetEndDriveSpeed() const
     return m_endDriveSpeed;
 }
 
-std::string PrimitiveParams::GetPathName() const
+const std::string& PrimitiveParams::GetPathName() const
 {
-	return m_pathName;
+	static const std::string noPath;
+	return m_program != nullptr ? m_program->GetPathName( m_pathIndex ) : noPath;
 }
 
 //Setters
@@ -95,6 +104,37 @@ void PrimitiveParams::SetDistance(float distance)
 	m_distance = distance;
 }
 
+TrajectoryGeneratorService::PathFuture PrimitiveParams::GetGeneratedPath() const
+{
+	return m_program != nullptr ? m_program->GetGeneratedPath( m_generatedPathIndex ) : TrajectoryGeneratorService::PathFuture();
+}
+
+int PrimitiveParams::GetGroupID() const
+{
+	return m_groupID;
+}
+
+PRIMITIVE_GROUP PrimitiveParams::GetGroupMode() const
+{
+	return m_groupMode;
+}
+
+void PrimitiveParams::SetGroup(int groupID, PRIMITIVE_GROUP groupMode)
+{
+	m_groupID = groupID;
+	m_groupMode = groupMode;
+}
+
+float PrimitiveParams::GetBlendTime() const
+{
+	return m_blendTime;
+}
+
+void PrimitiveParams::SetBlendTime(float blendTime)
+{
+	m_blendTime = blendTime;
+}
+
 IntakeStateMgr::INTAKE_STATE PrimitiveParams::GetIntakeState() const
 {
 	return m_intakeState;
@@ -18,12 +18,12 @@
 
 // C++ Includes
 #include <string>
-#include <vector>
 
 // FRC includes
 
 // Team 302 includes
 #include <auton/PrimitiveEnums.h>
+#include <auton/TrajectoryGeneratorService.h>
 #include <states/arm/ArmStateMgr.h>
 #include <states/ballrelease/BallReleaseStateMgr.h>
 #include <states/balltransfer/BallTransferStateMgr.h>
@@ -31,10 +31,14 @@
 
 // Third Party Includes
 
+class AutonProgram;
 
+/// @brief one primitive of an auton script; a plain record (no strings or heap) so an AutonProgram can
+///        keep a script in one contiguous vector.  The path name and generated path live in the program.
 class PrimitiveParams
 {
     public:
+        static constexpr int NO_INDEX = -1;
 
         PrimitiveParams
         (
@@ -46,7 +50,7 @@ class PrimitiveParams
                 float                                               heading,
                 float                                               startDriveSpeed,
                 float                                               endDriveSpeed,
-                std::string                                         pathName,
+                int                                                 pathIndex,          // AutonProgram::InternPath (NO_INDEX for none)
                 IntakeStateMgr::INTAKE_STATE                        intakeState,
                 BallTransferStateMgr::BALL_TRANSFER_STATE           transferState,
                 ArmStateMgr::ARM_STATE                              armState,
@@ -54,7 +58,7 @@ class PrimitiveParams
         );//Constructor. Takes in all parameters
 
         PrimitiveParams() = delete;
-        virtual ~PrimitiveParams() = default;//Destructor
+        ~PrimitiveParams() = default;//Destructor
 
 
         //Some getters
@@ -66,17 +70,33 @@ class PrimitiveParams
         float GetHeading() const;
         float GetDriveSpeed() const;
         float GetEndDriveSpeed() const;
-        std::string GetPathName() const;
+        const std::string& GetPathName() const;
         IntakeStateMgr::INTAKE_STATE GetIntakeState() const;
         BallTransferStateMgr::BALL_TRANSFER_STATE GetTransferState() const;
         ArmStateMgr::ARM_STATE GetArmState() const;
         BallReleaseStateMgr::BALL_RELEASE_STATE GetReleaseState() const;
 
 
+        /// @brief path being generated for this primitive (from the waypoints attribute); 
+        ///        not valid when the primitive uses a pathname or doesn't drive a path
+        TrajectoryGeneratorService::PathFuture GetGeneratedPath() const;
+
+        /// @brief group this primitive runs in; 0 means it runs by itself, otherwise the
+        ///        consecutive primitives with the same id run together
+        int GetGroupID() const;
+        PRIMITIVE_GROUP GetGroupMode() const;
+
+        /// @brief seconds before this primitive finishes that the next one may take over (0 waits for it to finish)
+        float GetBlendTime() const;
+
         //Setters
         void SetDistance(float distance);
+        void SetGroup(int groupID, PRIMITIVE_GROUP groupMode);
+        void SetBlendTime(float blendTime);
 
     private:
+        friend class AutonProgram;
+
         //Primitive Parameters
         PRIMITIVE_IDENTIFIER                                m_id; //Primitive ID
         float                                               m_time;
@@ -86,15 +106,18 @@ class PrimitiveParams
         float                                               m_heading;
         float                                               m_startDriveSpeed;
         float                                               m_endDriveSpeed;
-        std::string                                         m_pathName;
+        int                                                 m_pathIndex;
         IntakeStateMgr::INTAKE_STATE                        m_intakeState;
         BallTransferStateMgr::BALL_TRANSFER_STATE           m_transferState;
         ArmStateMgr::ARM_STATE                              m_armState;
         BallReleaseStateMgr::BALL_RELEASE_STATE             m_releaseState;
+        int                                                 m_generatedPathIndex;
+        int                                                 m_groupID;
+        PRIMITIVE_GROUP                                     m_groupMode;
+        float                                               m_blendTime;
+        const AutonProgram*                                 m_program;          // set when it is added to a program
 
 };
 
-typedef std::vector<PrimitiveParams*> PrimitiveParamsVector;
-
 
 
@@ -14,14 +14,19 @@
 //====================================================================================================================================================
 
 
+#include <exception>
 #include <iostream>
 #include <map>
+#include <sstream>
+#include <vector>
 
 
 #include <auton/PrimitiveParser.h>
+#include <auton/AutonProgram.h>
 
 #include <pugixml/pugixml.hpp>
 
+#include <frc/Filesystem.h>
 #include <frc/SmartDashboard/SmartDashboard.h>
 
 #include <states/arm/ArmStateMgr.h>
@@ -31,6 +36,7 @@
 
 #include <auton/PrimitiveParams.h>
 #include <auton/AutonSelector.h>
+#include <auton/TrajectoryGeneratorService.h>
 #include <auton/PrimitiveEnums.h>
 #include <auton/primitives/IPrimitive.h>
 #include <utils/Logger.h>
@@ -38,16 +44,27 @@
 using namespace std;
 using namespace pugi;
 
-PrimitiveParamsVector PrimitiveParser::ParseXML
+namespace
+{
+    /// @brief a primitive element and the group it was found in
+    struct GroupedNode
+    {
+        xml_node            node;
+        int                 groupID;
+        PRIMITIVE_GROUP     groupMode;
+    };
+}
+
+bool PrimitiveParser::ParseXML
 (
-    string     fileName
+    string          fileName,
+    AutonProgram&   program
 )
 {
 
-    PrimitiveParamsVector paramVector;
+    program.Clear( fileName );
 
     PRIMITIVE_IDENTIFIER        primitiveType = UNKNOWN_PRIMITIVE;
-    float                       time = 15.0;
     float                       distance = 0.0;
     float                       heading = 0.0;
     float                       startDriveSpeed = 0.0;
@@ -64,24 +81,33 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
     bool hasError = false;
     string fulldirfile = string("/home/lvuser/auton/");
     fulldirfile += fileName;
-    // initialize the xml string to enum maps
-    map<string, PRIMITIVE_IDENTIFIER> primStringToEnumMap;
-    primStringToEnumMap["DO_NOTHING"] = DO_NOTHING;
-    primStringToEnumMap["HOLD_POSITION"]  = HOLD_POSITION;
-    primStringToEnumMap["DRIVE_DISTANCE"] = DRIVE_DISTANCE;
-    primStringToEnumMap["DRIVE_TIME"] = DRIVE_TIME;
-    primStringToEnumMap["DRIVE_TO_WALL"] = DRIVE_TO_WALL;
-    primStringToEnumMap["TURN_ANGLE_ABS"] = TURN_ANGLE_ABS;
-    primStringToEnumMap["TURN_ANGLE_REL"] = TURN_ANGLE_REL;
-    primStringToEnumMap["DRIVE_PATH"] = DRIVE_PATH;
-    primStringToEnumMap["RESET_POSITION"] = RESET_POSITION;
+    if ( fileName.find( '/' ) != string::npos )
+    {
+        fulldirfile = fileName;     // a path rather than a name from the chooser (e.g. the desktop auton simulator)
+    }
+    // xml string to enum maps; built on the first parse and shared after that
+    static const map<string, PRIMITIVE_IDENTIFIER> primStringToEnumMap = { { "DO_NOTHING", DO_NOTHING },
+                                                                            { "HOLD_POSITION", HOLD_POSITION },
+                                                                            { "DRIVE_DISTANCE", DRIVE_DISTANCE },
+                                                                            { "DRIVE_TIME", DRIVE_TIME },
+                                                                            { "DRIVE_TO_WALL", DRIVE_TO_WALL },
+                                                                            { "TURN_ANGLE_ABS", TURN_ANGLE_ABS },
+                                                                            { "TURN_ANGLE_REL", TURN_ANGLE_REL },
+                                                                            { "DRIVE_PATH", DRIVE_PATH },
+                                                                            { "RESET_POSITION", RESET_POSITION },
+                                                                            { "WAIT_FOR_MECHANISMS", WAIT_FOR_MECHANISMS } };
+
+    static const map<string, PRIMITIVE_GROUP> groupStringToEnumMap = { { "parallel", PRIMITIVE_GROUP::PARALLEL },
+                                                                       { "race", PRIMITIVE_GROUP::RACE },
+                                                                       { "deadline", PRIMITIVE_GROUP::DEADLINE } };
 
     xml_document doc;
     xml_parse_result result = doc.load_file( fulldirfile.c_str() );
     if (!result)
     {
-        fulldirfile = string("/home/lvuser/deploy/auton/");
-        xml_parse_result result = doc.load_file( fulldirfile.c_str() );
+        fulldirfile = frc::filesystem::GetDeployDirectory() + string("/auton/");
+        fulldirfile += fileName;
+        result = doc.load_file( fulldirfile.c_str() );
     }
     
     if ( result )
@@ -91,11 +117,57 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
         for (xml_node node = auton.first_child(); node; node = node.next_sibling())
         {
             Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML"), string(node.name()));
-            for (xml_node primitiveNode = node.first_child(); primitiveNode; primitiveNode = primitiveNode.next_sibling())
+            // groups are flattened; their members keep a shared group id so CyclePrimitives runs them together
+            vector<GroupedNode> primitiveNodes;
+            int groupID = 0;
+            for (xml_node child = node.first_child(); child; child = child.next_sibling())
+            {
+                auto groupItr = groupStringToEnumMap.find( child.name() );
+                if ( groupItr != groupStringToEnumMap.end() )
+                {
+                    groupID++;
+                    for (xml_node member = child.first_child(); member; member = member.next_sibling())
+                    {
+                        primitiveNodes.emplace_back( GroupedNode{ member, groupID, groupItr->second } );
+                    }
+                }
+                else
+                {
+                    primitiveNodes.emplace_back( GroupedNode{ child, 0, PRIMITIVE_GROUP::SEQUENTIAL } );
+                }
+            }
+
+            // a generated path in the step after a generated path that blends into it starts where that path hands off
+            TrajectoryGeneratorService::PathFuture blendFromPath;
+            float blendFromTime = 0.0;
+            auto blendIntoGroup = -1;      // group id of the step blended into; -1 until its first primitive
+
+            for ( auto& groupedNode : primitiveNodes )
             {
+                if ( blendFromPath.valid() && blendIntoGroup != -1 && ( blendIntoGroup == 0 || groupedNode.groupID != blendIntoGroup ) )
+                {
+                    blendFromPath = TrajectoryGeneratorService::PathFuture();   // past the step blended into
+                    blendFromTime = 0.0;
+                }
+                if ( blendIntoGroup == -1 )
+                {
+                    blendIntoGroup = groupedNode.groupID;
+                }
+
+                auto primitiveNode = groupedNode.node;
                 Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML"), string(primitiveNode.name()));
                 if ( strcmp( primitiveNode.name(), "primitive") == 0 )
                 {
+                    // generated path settings only apply to the primitive they are on
+                    string  waypoints;
+                    float   maxVelocity = 0.0;
+                    float   maxAcceleration = 0.0;
+                    bool    reversed = false;
+
+                    // so do the time (CyclePrimitives times the primitive out after it) and blend time
+                    float   time = 15.0;
+                    float   blendTime = 0.0;
+
 
                     for (xml_attribute attr = primitiveNode.first_attribute(); attr; attr = attr.next_attribute())
                     {
@@ -122,6 +194,10 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
                         {
                             distance = attr.as_float();
                         }
+                        else if ( strcmp( attr.name(), "blendtime" ) == 0 )
+                        {
+                            blendTime = attr.as_float();
+                        }
                         else if ( strcmp( attr.name(), "heading" ) == 0 )
                         {
                             heading = attr.as_float();
@@ -146,6 +222,22 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
                         {
                             pathName = attr.value();
                         }
+                        else if ( strcmp( attr.name(), "waypoints") == 0)
+                        {
+                            waypoints = attr.value();
+                        }
+                        else if ( strcmp( attr.name(), "maxvelocity") == 0)
+                        {
+                            maxVelocity = attr.as_float();
+                        }
+                        else if ( strcmp( attr.name(), "maxacceleration") == 0)
+                        {
+                            maxAcceleration = attr.as_float();
+                        }
+                        else if ( strcmp( attr.name(), "reversed") == 0)
+                        {
+                            reversed = attr.as_bool();
+                        }
                         else if ( strcmp( attr.name(), "runIntake") == 0)
                         {
                             if (attr.as_bool())
@@ -192,25 +284,59 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
                             hasError = true;
                         }
                     }
+
+                    // start generating the path now, so it is ready by the time the primitive runs
+                    TrajectoryGeneratorService::PathFuture generatedPath;
+                    if ( !hasError && !waypoints.empty() )
+                    {
+                        TrajectoryGeneratorService::Request request;
+                        request.maxVelocity     = units::meters_per_second_t( maxVelocity );
+                        request.maxAcceleration = units::meters_per_second_squared_t( maxAcceleration );
+                        request.reversed        = reversed;
+                        request.blendFrom       = blendFromPath;
+                        request.blendTime       = units::second_t( blendFromTime );
+                        if ( ParseWaypoints( waypoints, request ) )
+                        {
+                            generatedPath = TrajectoryGeneratorService::GetInstance()->Submit( request );
+                        }
+                        else
+                        {
+                            Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid waypoints"), waypoints );
+                            hasError = true;
+                        }
+                    }
+
                     if ( !hasError )
                     {   
                         cout << "Primitive Type " << primitiveType << endl;
-                        paramVector.emplace_back( new PrimitiveParams( primitiveType,
-                                                                       time,
-                                                                       distance,
-                                                                       xloc,
-                                                                       yloc,
-                                                                       heading,
-                                                                       startDriveSpeed,
-                                                                       endDriveSpeed,
-                                                                       pathName,
-                                                                       intakeState,
-                                                                       transferState,
-                                                                       armState,
-                                                                       releaseState ) );
+                        PrimitiveParams primitive( primitiveType,
+                                                   time,
+                                                   distance,
+                                                   xloc,
+                                                   yloc,
+                                                   heading,
+                                                   startDriveSpeed,
+                                                   endDriveSpeed,
+                                                   program.InternPath( pathName ),
+                                                   intakeState,
+                                                   transferState,
+                                                   armState,
+                                                   releaseState );
+                        primitive.SetGroup( groupedNode.groupID, groupedNode.groupMode );
+                        primitive.SetBlendTime( blendTime );
+                        program.Add( primitive, generatedPath );
+
+                        // only a primitive that is a step by itself blends into the next one
+                        if ( primitiveType == DRIVE_PATH && groupedNode.groupID == 0 && blendTime > 0.0 )
+                        {
+                            blendFromPath  = generatedPath;
+                            blendFromTime  = blendTime;
+                            blendIntoGroup = -1;
+                        }
                     }
                     else 
                     {
+                        blendFromPath = TrajectoryGeneratorService::PathFuture();
                          Logger::GetLogger() -> LogError( string("PrimitiveParser::ParseXML"), string("Has Error"));
                     }
                 }
@@ -222,6 +348,65 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
         Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML error parsing file"), fileName );
         Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML error message"), result.description() );
     }
-    Logger::GetLogger() -> LogError( string("PrimitiveParser::ParseXML "), to_string(paramVector.size()));
-    return paramVector;
+    Logger::GetLogger() -> LogError( string("PrimitiveParser::ParseXML "), to_string(program.GetSize()));
+    return result && !hasError;
+}
+
+/// @brief parse the waypoints attribute: "x,y,heading; x,y; ... ; x,y,heading" (meters, degrees).
+///        The first entry is the start pose, the last is the end pose and any in between are
+///        interior waypoints.
+/// @param [in] string waypoints - attribute value
+/// @param [out] TrajectoryGeneratorService::Request& request - start, interior waypoints and end are set
+/// @return bool - false if the attribute isn't in that form
+bool PrimitiveParser::ParseWaypoints
+(
+    const string&                           waypoints,
+    TrajectoryGeneratorService::Request&    request
+)
+{
+    vector<vector<double>> points;
+    stringstream entries( waypoints );
+    string entry;
+    while ( getline( entries, entry, ';' ) )
+    {
+        vector<double> values;
+        stringstream fields( entry );
+        string field;
+        while ( getline( fields, field, ',' ) )
+        {
+            try
+            {
+                values.emplace_back( stod( field ) );
+            }
+            catch ( const exception& )
+            {
+                return false;
+            }
+        }
+        if ( !values.empty() )
+        {
+            points.emplace_back( values );
+        }
+    }
+
+    if ( points.size() < 2 || points.front().size() != 3 || points.back().size() != 3 )
+    {
+        return false;
+    }
+
+    auto& start = points.front();
+    auto& end   = points.back();
+    request.start = frc::Pose2d( units::meter_t( start[0] ), units::meter_t( start[1] ), frc::Rotation2d( units::degree_t( start[2] ) ) );
+    request.end   = frc::Pose2d( units::meter_t( end[0] ), units::meter_t( end[1] ), frc::Rotation2d( units::degree_t( end[2] ) ) );
+
+    request.interiorWaypoints.clear();
+    for ( size_t inx=1; inx+1<points.size(); ++inx )
+    {
+        if ( points[inx].size() != 2 )
+        {
+            return false;
+        }
+        request.interiorWaypoints.emplace_back( units::meter_t( points[inx][0] ), units::meter_t( points[inx][1] ) );
+    }
+    return true;
 }
@@ -26,16 +26,30 @@
 
 
 
+#include <auton/AutonProgram.h>
 #include <auton/PrimitiveParams.h>
+#include <auton/TrajectoryGeneratorService.h>
 
 #include <iostream>
 
 class PrimitiveParser
 {
     public:
-        static PrimitiveParamsVector ParseXML
+        /// @brief parse an auton script into a program (cleared first, so its storage is reused)
+        /// @param [in] std::string fileName - file name under /home/lvuser/auton, or a path to the file
+        /// @param [out] AutonProgram& program - the script's primitives
+        /// @return bool - false if the file couldn't be read or a primitive had an error (it was left out)
+        static bool ParseXML
         (
-            std::string     fileName
+            std::string     fileName,
+            AutonProgram&   program
+        );
+
+    private:
+        static bool ParseWaypoints
+        (
+            const std::string&                      waypoints,
+            TrajectoryGeneratorService::Request&    request
         );
 };
 
@@ -0,0 +1,287 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TrajectoryCache.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Loads the PathWeaver paths once and keeps binary sidecars of them.
+///
+///     Sidecar layout (native byte order; it is only read back on the machine that wrote it):
+///         SidecarHeader
+///         count * STATE_FIELDS doubles: t, velocity, acceleration, x, y, heading, curvature
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// FRC includes
+#include <frc/Filesystem.h>
+#include <frc/Timer.h>
+#include <frc/trajectory/Trajectory.h>
+#include <frc/trajectory/TrajectoryUtil.h>
+#include <wpi/MemoryBuffer.h>
+#include <wpi/fs.h>
+
+// Team 302 includes
+#include <auton/TrajectoryCache.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    struct SidecarHeader
+    {
+        char        magic[8];
+        uint32_t    version;
+        uint32_t    count;
+        uint64_t    hash;
+    };
+
+    const char      SIDECAR_MAGIC[8] = { 'T', '3', '0', '2', 'P', 'A', 'T', 'H' };
+    const uint32_t  SIDECAR_VERSION  = 1;
+    const size_t    STATE_FIELDS     = 7;
+}
+
+TrajectoryCache* TrajectoryCache::m_instance = nullptr;
+TrajectoryCache* TrajectoryCache::GetInstance()
+{
+    if ( TrajectoryCache::m_instance == nullptr )
+    {
+        TrajectoryCache::m_instance = new TrajectoryCache();
+    }
+    return TrajectoryCache::m_instance;
+}
+
+TrajectoryCache::TrajectoryCache() : m_pathDir( frc::filesystem::GetDeployDirectory() + "/paths" ),
+                                     m_cacheDir( frc::filesystem::GetOperatingDirectory() + "/pathcache" ),
+                                     m_paths()
+{
+}
+
+void TrajectoryCache::Preload()
+{
+    auto start = frc::Timer::GetFPGATimestamp();
+
+    error_code ec;
+    fs::create_directories( fs::path( m_cacheDir ), ec );
+
+    size_t count = 0;
+    for ( fs::directory_iterator it( fs::path( m_pathDir ), ec ), end; !ec && it != end; it.increment( ec ) )
+    {
+        auto fileName = it->path().filename().string();
+        if ( it->path().extension() == ".json" && m_paths.find( fileName ) == m_paths.end() )
+        {
+            auto path = Load( fileName );
+            if ( path.get() != nullptr )
+            {
+                m_paths[fileName] = path;
+                count++;
+            }
+        }
+    }
+
+    auto msg = string( "loaded " ) + to_string( count ) + string( " paths in " ) + to_string( ( frc::Timer::GetFPGATimestamp() - start ).to<double>() ) + string( " s" );
+    Logger::GetLogger()->LogError( Logger::LOGGER_LEVEL::PRINT, string( "TrajectoryCache::Preload" ), msg );
+}
+
+shared_ptr<const TrajectoryCache::CachedPath> TrajectoryCache::GetPath
+(
+    const string&       pathName
+)
+{
+    auto it = m_paths.find( pathName );
+    if ( it != m_paths.end() )
+    {
+        return it->second;
+    }
+
+    // not preloaded (e.g. deployed after boot); load it now so auton still runs
+    Logger::GetLogger()->LogError( string( "TrajectoryCache::GetPath" ), string( "path wasn't preloaded: " ) + pathName );
+    auto path = Load( pathName );
+    if ( path.get() != nullptr )
+    {
+        m_paths[pathName] = path;
+    }
+    return path;
+}
+
+shared_ptr<const TrajectoryCache::CachedPath> TrajectoryCache::Load
+(
+    const string&       pathName
+)
+{
+    auto jsonFile = m_pathDir + "/" + pathName;
+
+    error_code ec;
+    auto json = wpi::MemoryBuffer::GetFile( jsonFile, ec );
+    if ( ec || json.get() == nullptr )
+    {
+        Logger::GetLogger()->LogError( string( "TrajectoryCache::Load" ), string( "unable to read " ) + jsonFile );
+        return nullptr;
+    }
+
+    auto hash    = Hash( json.get()->begin(), json.get()->size() );
+    auto sidecar = m_cacheDir + "/" + pathName + ".bin";
+
+    auto path = make_shared<CachedPath>();
+    vector<frc::Trajectory::State> states;
+    if ( ReadSidecar( sidecar, hash, states ) )
+    {
+        path.get()->trajectory = frc::Trajectory( states );
+    }
+    else
+    {
+        try
+        {
+            path.get()->trajectory = frc::TrajectoryUtil::FromPathweaverJson( jsonFile );
+        }
+        catch ( const exception& e )
+        {
+            Logger::GetLogger()->LogError( string( "TrajectoryCache::Load" ), string( "unable to parse " ) + jsonFile + string( ": " ) + e.what() );
+            return nullptr;
+        }
+        WriteSidecar( sidecar, hash, path.get()->trajectory.States() );
+    }
+
+    if ( path.get()->trajectory.States().empty() )
+    {
+        Logger::GetLogger()->LogError( string( "TrajectoryCache::Load" ), string( "path has no states: " ) + jsonFile );
+        return nullptr;
+    }
+    path.get()->table.Build( path.get()->trajectory );
+    return path;
+}
+
+bool TrajectoryCache::ReadSidecar
+(
+    const string&                   fileName,
+    uint64_t                        hash,
+    vector<frc::Trajectory::State>& states
+) const
+{
+    error_code ec;
+    auto buffer = wpi::MemoryBuffer::GetFile( fileName, ec );
+    if ( ec || buffer.get() == nullptr || buffer.get()->size() < sizeof( SidecarHeader ) )
+    {
+        return false;
+    }
+
+    SidecarHeader header;
+    memcpy( &header, buffer.get()->begin(), sizeof( header ) );
+    if ( memcmp( header.magic, SIDECAR_MAGIC, sizeof( SIDECAR_MAGIC ) ) != 0 ||
+         header.version != SIDECAR_VERSION ||
+         header.hash != hash ||
+         buffer.get()->size() != sizeof( header ) + header.count * STATE_FIELDS * sizeof( double ) )
+    {
+        return false;   // stale or foreign; it gets rewritten after the json is parsed
+    }
+
+    states.clear();
+    states.reserve( header.count );
+    auto data = buffer.get()->begin() + sizeof( header );
+    for ( uint32_t inx=0; inx<header.count; ++inx )
+    {
+        double fields[STATE_FIELDS];
+        memcpy( fields, data, sizeof( fields ) );
+        data += sizeof( fields );
+
+        frc::Trajectory::State state;
+        state.t             = units::second_t( fields[0] );
+        state.velocity      = units::meters_per_second_t( fields[1] );
+        state.acceleration  = units::meters_per_second_squared_t( fields[2] );
+        state.pose          = frc::Pose2d( units::meter_t( fields[3] ), units::meter_t( fields[4] ), frc::Rotation2d( units::radian_t( fields[5] ) ) );
+        state.curvature     = units::curvature_t( fields[6] );
+        states.emplace_back( state );
+    }
+    return true;
+}
+
+void TrajectoryCache::WriteSidecar
+(
+    const string&                           fileName,
+    uint64_t                                hash,
+    const vector<frc::Trajectory::State>&   states
+) const
+{
+    // write to a temporary file and rename it, so a brown out mid write can't leave a truncated sidecar
+    auto tempName = fileName + ".tmp";
+    {
+        ofstream out( tempName, ios::binary | ios::trunc );
+        if ( !out )
+        {
+            Logger::GetLogger()->LogError( string( "TrajectoryCache::WriteSidecar" ), string( "unable to write " ) + tempName );
+            return;
+        }
+
+        SidecarHeader header;
+        memcpy( header.magic, SIDECAR_MAGIC, sizeof( SIDECAR_MAGIC ) );
+        header.version = SIDECAR_VERSION;
+        header.count   = static_cast<uint32_t>( states.size() );
+        header.hash    = hash;
+        out.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+
+        for ( auto& state : states )
+        {
+            double fields[STATE_FIELDS] = { state.t.to<double>(),
+                                            state.velocity.to<double>(),
+                                            state.acceleration.to<double>(),
+                                            state.pose.X().to<double>(),
+                                            state.pose.Y().to<double>(),
+                                            state.pose.Rotation().Radians().to<double>(),
+                                            state.curvature.to<double>() };
+            out.write( reinterpret_cast<const char*>( fields ), sizeof( fields ) );
+        }
+        if ( !out )
+        {
+            Logger::GetLogger()->LogError( string( "TrajectoryCache::WriteSidecar" ), string( "unable to write " ) + tempName );
+            return;
+        }
+    }
+
+    error_code ec;
+    fs::rename( fs::path( tempName ), fs::path( fileName ), ec );
+    if ( ec )
+    {
+        Logger::GetLogger()->LogError( string( "TrajectoryCache::WriteSidecar" ), string( "unable to rename " ) + tempName );
+    }
+}
+
+/// @brief 64 bit FNV-1a of the json file contents
+uint64_t TrajectoryCache::Hash
+(
+    const uint8_t*      data,
+    size_t              size
+)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for ( size_t inx=0; inx<size; ++inx )
+    {
+        hash ^= data[inx];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
@@ -0,0 +1,104 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TrajectoryCache.h
+//========================================================================================================
+///
+/// File Description:
+///     Loads the PathWeaver paths under deploy/paths once (at RobotInit) so DrivePath and
+///     ResetPosition only look them up during autonomous.  Each parsed path is also written to a
+///     binary sidecar keyed by a hash of its json; later boots map the sidecar instead of parsing
+///     the json again.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// FRC includes
+#include <frc/trajectory/Trajectory.h>
+
+// Team 302 includes
+#include <utils/TrajectoryTable.h>
+
+// Third Party Includes
+
+
+class TrajectoryCache
+{
+    public:
+        /// @brief a loaded path: the trajectory and its fixed step lookup table
+        struct CachedPath
+        {
+            frc::Trajectory     trajectory;
+            TrajectoryTable     table;
+        };
+
+        static TrajectoryCache* GetInstance();
+
+        /// @brief load every json file under deploy/paths that isn't already loaded
+        void Preload();
+
+        /// @brief find a path by file name (e.g. curveRight.wpilib.json); loads it if Preload missed it
+        /// @param [in] const std::string& pathName - file name under deploy/paths
+        /// @return std::shared_ptr<const CachedPath> - the path (nullptr if it can't be loaded)
+        std::shared_ptr<const CachedPath> GetPath
+        (
+            const std::string&      pathName
+        );
+
+    private:
+        TrajectoryCache();
+        ~TrajectoryCache() = default;
+
+        std::shared_ptr<const CachedPath> Load
+        (
+            const std::string&      pathName
+        );
+
+        bool ReadSidecar
+        (
+            const std::string&                      fileName,
+            uint64_t                                hash,
+            std::vector<frc::Trajectory::State>&    states
+        ) const;
+
+        void WriteSidecar
+        (
+            const std::string&                          fileName,
+            uint64_t                                    hash,
+            const std::vector<frc::Trajectory::State>&  states
+        ) const;
+
+        static uint64_t Hash
+        (
+            const uint8_t*          data,
+            size_t                  size
+        );
+
+        static TrajectoryCache*     m_instance;
+
+        std::string                 m_pathDir;      // deploy/paths
+        std::string                 m_cacheDir;     // binary sidecars
+        std::unordered_map<std::string, std::shared_ptr<const CachedPath>>  m_paths;
+};
@@ -0,0 +1,166 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TrajectoryGeneratorService.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Generates trajectories with frc::TrajectoryGenerator on a worker thread.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+// FRC includes
+#include <frc/trajectory/TrajectoryConfig.h>
+#include <frc/trajectory/TrajectoryGenerator.h>
+#include <units/math.h>
+
+// Team 302 includes
+#include <auton/TrajectoryGeneratorService.h>
+#include <subsys/ChassisFactory.h>
+#include <subsys/interfaces/IChassis.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+TrajectoryGeneratorService* TrajectoryGeneratorService::m_instance = nullptr;
+TrajectoryGeneratorService* TrajectoryGeneratorService::GetInstance()
+{
+    if ( TrajectoryGeneratorService::m_instance == nullptr )
+    {
+        TrajectoryGeneratorService::m_instance = new TrajectoryGeneratorService();
+    }
+    return TrajectoryGeneratorService::m_instance;
+}
+
+TrajectoryGeneratorService::TrajectoryGeneratorService() : m_mutex(),
+                                                           m_workAvailable(),
+                                                           m_jobs(),
+                                                           m_worker()
+{
+}
+
+TrajectoryGeneratorService::PathFuture TrajectoryGeneratorService::Submit
+(
+    const Request&      request
+)
+{
+    promise<shared_ptr<const TrajectoryCache::CachedPath>> result;
+    auto future = result.get_future().share();
+    {
+        lock_guard<mutex> lock( m_mutex );
+        m_jobs.emplace_back( request, move( result ) );
+        if ( !m_worker.joinable() )
+        {
+            // the service lives for the life of the program, so the worker is never joined
+            m_worker = thread( &TrajectoryGeneratorService::Worker, this );
+        }
+    }
+    m_workAvailable.notify_one();
+    return future;
+}
+
+bool TrajectoryGeneratorService::IsReady
+(
+    const PathFuture&   future
+)
+{
+    return future.valid() && future.wait_for( chrono::seconds( 0 ) ) == future_status::ready;
+}
+
+void TrajectoryGeneratorService::Worker()
+{
+    while ( true )
+    {
+        Job job;
+        {
+            unique_lock<mutex> lock( m_mutex );
+            m_workAvailable.wait( lock, [this] { return !m_jobs.empty(); } );
+            job = move( m_jobs.front() );
+            m_jobs.pop_front();
+        }
+        job.second.set_value( Generate( job.first ) );
+    }
+}
+
+shared_ptr<const TrajectoryCache::CachedPath> TrajectoryGeneratorService::Generate
+(
+    const Request&      request
+) const
+{
+    auto maxVelocity     = request.maxVelocity;
+    auto maxAcceleration = request.maxAcceleration;
+    auto chassis = ChassisFactory::GetChassisFactory()->GetIChassis();
+    if ( maxVelocity <= units::meters_per_second_t( 0 ) && chassis != nullptr )
+    {
+        maxVelocity = chassis->GetMaxSpeed();
+    }
+    if ( maxAcceleration <= units::meters_per_second_squared_t( 0 ) )
+    {
+        maxAcceleration = maxVelocity / units::second_t( 1.0 );    // full speed in a second
+    }
+
+    try
+    {
+        frc::TrajectoryConfig config( maxVelocity, maxAcceleration );
+        config.SetReversed( request.reversed );
+
+        // the path blended from was submitted first, so it is already done; start from its pose and
+        // velocity at the hand off instead of the script's start pose, which is the end of that path
+        auto start = request.start;
+        if ( request.blendFrom.valid() && request.blendFrom.get() != nullptr )
+        {
+            auto& previous = request.blendFrom.get()->trajectory;
+            auto handoff = previous.Sample( previous.TotalTime() - request.blendTime );
+            start = handoff.pose;
+            if ( ( handoff.velocity < units::meters_per_second_t( 0 ) ) == request.reversed )
+            {
+                config.SetStartVelocity( units::math::min( units::math::abs( handoff.velocity ), maxVelocity ) );
+            }
+            else
+            {
+                Logger::GetLogger()->LogError( string( "TrajectoryGeneratorService::Generate" ), string( "blended into a path driving the other way; it starts from a stop" ) );
+            }
+        }
+
+        auto path = make_shared<TrajectoryCache::CachedPath>();
+        path.get()->trajectory = frc::TrajectoryGenerator::GenerateTrajectory( start, request.interiorWaypoints, request.end, config );
+        if ( path.get()->trajectory.States().empty() )
+        {
+            Logger::GetLogger()->LogError( string( "TrajectoryGeneratorService::Generate" ), string( "generated an empty trajectory" ) );
+            return nullptr;
+        }
+        path.get()->table.Build( path.get()->trajectory );
+        return path;
+    }
+    catch ( const exception& e )
+    {
+        Logger::GetLogger()->LogError( string( "TrajectoryGeneratorService::Generate" ), string( e.what() ) );
+    }
+    return nullptr;
+}
@@ -0,0 +1,109 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TrajectoryGeneratorService.h
+//========================================================================================================
+///
+/// File Description:
+///     Generates trajectories with frc::TrajectoryGenerator on a worker thread.  Submit() queues a
+///     request and returns right away; the result is picked up from the returned future once it
+///     is ready, so the robot loop never waits on generation.  Requests are worked in the order
+///     they were submitted.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <units/acceleration.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+#include <auton/TrajectoryCache.h>
+
+// Third Party Includes
+
+
+class TrajectoryGeneratorService
+{
+    public:
+        using PathFuture = std::shared_future<std::shared_ptr<const TrajectoryCache::CachedPath>>;
+
+        /// @brief what to generate; zero velocity/acceleration use the chassis limits.  A path that 
+        ///        an earlier generated path blends into starts from that path's pose and velocity
+        ///        blendTime before its end (in place of start).
+        struct Request
+        {
+            frc::Pose2d                             start;
+            std::vector<frc::Translation2d>         interiorWaypoints;
+            frc::Pose2d                             end;
+            units::meters_per_second_t              maxVelocity;
+            units::meters_per_second_squared_t      maxAcceleration;
+            bool                                    reversed;
+            PathFuture                              blendFrom;      // path blending into this one (may be invalid)
+            units::second_t                         blendTime;
+        };
+
+        static TrajectoryGeneratorService* GetInstance();
+
+        /// @brief queue a trajectory to generate
+        /// @param [in] const Request& request - poses and constraints
+        /// @return PathFuture - holds the path (nullptr if it couldn't be generated) once it is ready
+        PathFuture Submit
+        (
+            const Request&      request
+        );
+
+        /// @brief is a future's path ready (never blocks)
+        static bool IsReady
+        (
+            const PathFuture&   future
+        );
+
+    private:
+        TrajectoryGeneratorService();
+        ~TrajectoryGeneratorService() = default;
+
+        void Worker();
+
+        std::shared_ptr<const TrajectoryCache::CachedPath> Generate
+        (
+            const Request&      request
+        ) const;
+
+        using Job = std::pair<Request, std::promise<std::shared_ptr<const TrajectoryCache::CachedPath>>>;
+
+        static TrajectoryGeneratorService*  m_instance;
+
+        std::mutex                  m_mutex;
+        std::condition_variable     m_workAvailable;
+        std::deque<Job>             m_jobs;
+        std::thread                 m_worker;       // started on the first Submit
+};
@@ -24,6 +24,9 @@
 
 // 302 Includes
 #include <auton/primitives/DrivePath.h>
+#include <auton/TrajectoryGeneratorService.h>
+#include <hw/CanBusScheduler.h>
+#include <subsys/VisionPoseEstimator.h>
 #include <utils/Logger.h>
 
 #include <wpi/fs.h>
@@ -35,26 +38,42 @@ using namespace wpi::math;
 
 DrivePath::DrivePath() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChassis()),
                          m_timer(make_unique<Timer>()),
-                         m_currentChassisPosition(m_chassis.get()->GetPose()),
-                         m_trajectory(),
-                         m_runHoloController(false),
+                         m_currentChassisPosition(VisionPoseEstimator::GetInstance()->GetEstimatedPose()),
+                         m_path(),
+                         m_generatedPath(),
+                         m_runHoloController(m_chassis.get()->IsHolonomic()),
                          m_ramseteController(),
                          m_holoController(frc2::PIDController{1, 0, 0},
                                           frc2::PIDController{1, 0, 0},
                                           frc::ProfiledPIDController<units::radian>{1, 0, 0,
                                                                                     frc::TrapezoidProfile<units::radian>::Constraints{6.28_rad_per_s, 3.14_rad_per_s / 1_s}}),
                          //max velocity of 1 rotation per second and a max acceleration of 180 degrees per second squared.
-                         m_PrevPos(m_chassis.get()->GetPose()),
+                         m_PrevPos(VisionPoseEstimator::GetInstance()->GetEstimatedPose()),
                          m_PosChgTimer(make_unique<Timer>()),
                          m_timesRun(0),
                          m_targetPose(),
                          m_deltaX(0.0),
                          m_deltaY(0.0),
-                         m_trajectoryStates(),
-                         m_desiredState()
+                         m_blendTime(0_s),
+                         m_desiredState(),
+                         m_ntHandles()
 
 {
-    m_trajectoryStates.clear();
+    auto logger = Logger::GetLogger();
+    m_ntHandles[NT_VALUE::RUNNING]            = logger->RegisterNtEntry("DrivePath" + m_pathname, "Running");
+    m_ntHandles[NT_VALUE::TIMES_RAN]          = logger->RegisterNtEntry("DrivePath" + m_pathname, "Times Ran");
+    m_ntHandles[NT_VALUE::CHASSIS_SPEEDS_X]   = logger->RegisterNtEntry("DrivePathValues", "ChassisSpeedsX");
+    m_ntHandles[NT_VALUE::CHASSIS_SPEEDS_Y]   = logger->RegisterNtEntry("DrivePathValues", "ChassisSpeedsY");
+    m_ntHandles[NT_VALUE::CHASSIS_SPEEDS_Z]   = logger->RegisterNtEntry("DrivePathValues", "ChassisSpeedsZ");
+    m_ntHandles[NT_VALUE::DESIRED_POSE_X]     = logger->RegisterNtEntry("DrivePathValues", "DesiredPoseX");
+    m_ntHandles[NT_VALUE::DESIRED_POSE_Y]     = logger->RegisterNtEntry("DrivePathValues", "DesiredPoseY");
+    m_ntHandles[NT_VALUE::DESIRED_POSE_OMEGA] = logger->RegisterNtEntry("DrivePathValues", "DesiredPoseOmega");
+    m_ntHandles[NT_VALUE::CURRENT_POS_X]      = logger->RegisterNtEntry("DrivePathValues", "CurrentPosX");
+    m_ntHandles[NT_VALUE::CURRENT_POS_Y]      = logger->RegisterNtEntry("DrivePathValues", "CurrentPosY");
+    m_ntHandles[NT_VALUE::CURRENT_POS_OMEGA]  = logger->RegisterNtEntry("DrivePathValues", "CurrentPosOmega");
+    m_ntHandles[NT_VALUE::DELTA_X]            = logger->RegisterNtEntry("DeltaValues", "DeltaX");
+    m_ntHandles[NT_VALUE::DELTA_Y]            = logger->RegisterNtEntry("DeltaValues", "DeltaY");
+    m_ntHandles[NT_VALUE::CURRENT_TIME]       = logger->RegisterNtEntry("DrivePathValues", "CurrentTime");
 }
 void DrivePath::Init(PrimitiveParams *params)
 {
@@ -66,19 +85,46 @@ void DrivePath::Init(PrimitiveParams *params)
     Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "WhyDone", "Not done");
     Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Times Ran", 0);
 
-    m_trajectoryStates.clear(); //Clears the primitive of previous path/trajectory
+    m_path.reset(); //Clears the primitive of previous path/trajectory
 
     m_wasMoving = false;
+    m_blendTime = units::second_t(params->GetBlendTime());
 
     Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Initialized", "True"); //Signals that drive path is initialized in the console
 
-    GetTrajectory(params->GetPathName());  //Parses path from json file based on path name given in xml
-    
-    Logger::GetLogger()->ToNtTable(m_pathname + "Trajectory", "Time", m_trajectory.TotalTime().to<double>());// Debugging
-    
-    if (!m_trajectoryStates.empty()) // only go if path name found
+    m_generatedPath = params->GetGeneratedPath();  //Path generated from the xml waypoints (may still be generating)
+    if (m_generatedPath.valid())
+    {
+        TakeGeneratedPath();
+    }
+    else
+    {
+        GetTrajectory(params->GetPathName());  //Looks up the path (preloaded by TrajectoryCache) based on path name given in xml
+        StartPath();
+    }
+    m_timesRun = 0;
+}
+
+//Picks up the generated path if the generator has finished it; never waits for it
+void DrivePath::TakeGeneratedPath()
+{
+    if (TrajectoryGeneratorService::IsReady(m_generatedPath))
+    {
+        m_path = m_generatedPath.get();
+        m_generatedPath = TrajectoryGeneratorService::PathFuture();
+        StartPath();
+    }
+}
+
+void DrivePath::StartPath()
+{
+    if (m_path.get() != nullptr) // only go if path name found
     {
-        m_desiredState = m_trajectoryStates.front(); //m_desiredState is the first state, or starting position
+        Logger::GetLogger()->ToNtTable(m_pathname + "Trajectory", "Time", m_path.get()->trajectory.TotalTime().to<double>());// Debugging
+
+        m_desiredState = m_path.get()->table.Sample(0_s); //m_desiredState is the first state, or starting position
+
+        CanBusScheduler::GetInstance()->SetPathFollowing(true); //Fast chassis feedback while the path runs
 
         m_timer.get()->Reset(); //Restarts and starts timer
         m_timer.get()->Start();
@@ -107,11 +153,11 @@ void DrivePath::Init(PrimitiveParams *params)
 
         //Sampling means to grab a state based on the time, if we want to know what state we should be running at 5 seconds,
         //we will sample the 5 second state.
-        auto targetState = m_trajectory.Sample(m_trajectory.TotalTime());  //"Samples" or grabs the position we should be at based on time
+        auto targetState = m_path.get()->table.Sample(m_path.get()->table.GetTotalTime());  //"Samples" or grabs the position we should be at based on time
 
         m_targetPose = targetState.pose;  //Target pose represents the pose that we want to be at, based on the target state from above
 
-        auto currPose = m_chassis.get()->GetPose(); //Grabs the current pose of the robot to compare to the target pose
+        auto currPose = VisionPoseEstimator::GetInstance()->GetEstimatedPose(); //Grabs the current pose of the robot to compare to the target pose
         auto trans = m_targetPose - currPose; //Translation / Delta of the target pose and current pose
 
         m_deltaX = trans.X().to<double>();  //Separates the delta "trans" from above into two variables for x and y
@@ -119,18 +165,22 @@ void DrivePath::Init(PrimitiveParams *params)
 
         //m_chassis.get()->RunWPIAlgorithm(true); //Determines what pose estimation method we will use, we have a few using different methods/equations
     }
-    m_timesRun = 0;
 }
 void DrivePath::Run()
 {
-    Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Running", "True");
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::RUNNING], string("True"));
+
+    if (m_generatedPath.valid()) //Still waiting on the generator; hold still until the path is ready
+    {
+        TakeGeneratedPath();
+    }
 
-    if (!m_trajectoryStates.empty()) //If we have a path parsed / have states to run
+    if (m_path.get() != nullptr) //If we have a path parsed / have states to run
     {
         // debugging
         m_timesRun++;
         
-        Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Times Ran", m_timesRun);
+        Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::TIMES_RAN], static_cast<double>(m_timesRun));
 
         // calculate where we are and where we want to be
         CalcCurrentAndDesiredStates();
@@ -140,9 +190,9 @@ void DrivePath::Run()
                                                       m_ramseteController.Calculate(m_currentChassisPosition, m_desiredState);
 
         // debugging
-        Logger::GetLogger()->ToNtTable("DrivePathValues", "ChassisSpeedsX", refChassisSpeeds.vx());
-        Logger::GetLogger()->ToNtTable("DrivePathValues", "ChassisSpeedsY", refChassisSpeeds.vy());
-        Logger::GetLogger()->ToNtTable("DrivePathValues", "ChassisSpeedsZ", units::degrees_per_second_t(refChassisSpeeds.omega()).to<double>());
+        Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::CHASSIS_SPEEDS_X], refChassisSpeeds.vx());
+        Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::CHASSIS_SPEEDS_Y], refChassisSpeeds.vy());
+        Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::CHASSIS_SPEEDS_Z], units::degrees_per_second_t(refChassisSpeeds.omega()).to<double>());
 
         // Run the chassis
         m_chassis->Drive(refChassisSpeeds);
@@ -163,11 +213,16 @@ bool DrivePath::IsDone() //Default primitive function to determine if the primit
 
     bool isDone = false;
     string whyDone = ""; //debugging variable that we used to determine why the path was stopping
+
+    if (m_generatedPath.valid()) //The path hasn't been generated yet
+    {
+        return false;
+    }
     
-    if (!m_trajectoryStates.empty()) //If we have states... 
+    if (m_path.get() != nullptr) //If we have states... 
     {
         // Check if the current pose and the trajectory's final pose are the same
-        auto curPos = m_chassis.get()->GetPose();
+        auto curPos = VisionPoseEstimator::GetInstance()->GetEstimatedPose();
         //isDone = IsSamePose(curPos, m_targetPose, 100.0);
         if (IsSamePose(curPos, m_targetPose, 100.0))
         {
@@ -223,16 +278,18 @@ bool DrivePath::IsDone() //Default primitive function to determine if the primit
         // a new state.
         if (!isDone)
         {
-            //return (units::second_t(m_timer.get()->Get()) >= m_trajectory.TotalTime()); 
+            //return (units::second_t(m_timer.get()->Get()) >= m_path.get()->trajectory.TotalTime()); 
         }
     }
     else
     {
         Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Done", "True");
+        CanBusScheduler::GetInstance()->SetPathFollowing(false);
         return true;
     }
     if (isDone)
     {   //debugging
+        CanBusScheduler::GetInstance()->SetPathFollowing(false);
         Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Done", "True");
         Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "WhyDone", whyDone);
         Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "DrivePath" + m_pathname, "Is done because: " + whyDone);
@@ -241,6 +298,25 @@ bool DrivePath::IsDone() //Default primitive function to determine if the primit
     
 }
 
+bool DrivePath::InBlendWindow()
+{
+    if (m_blendTime <= 0_s || m_generatedPath.valid() || m_path.get() == nullptr)
+    {
+        return false;
+    }
+
+    // the next primitive takes over while the robot still has this path's velocity; a path blended into
+    // is generated from this path's pose and velocity at this point, so it picks up where this one is
+    auto blending = m_timer.get()->Get() >= m_path.get()->trajectory.TotalTime() - m_blendTime;
+    if (blending)
+    {
+        CanBusScheduler::GetInstance()->SetPathFollowing(false);
+        Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Done", "True");
+        Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "WhyDone", string("Blending into the next primitive"));
+    }
+    return blending;
+}
+
 bool DrivePath::IsSamePose(frc::Pose2d lCurPos, frc::Pose2d lPrevPos, double tolerance) //position checking functions
 {
     // Detect if the two poses are the same within a tolerance
@@ -259,50 +335,39 @@ bool DrivePath::IsSamePose(frc::Pose2d lCurPos, frc::Pose2d lPrevPos, double tol
     return (dDeltaX <= tolerance && dDeltaY <= tolerance);
 }
 
-void DrivePath::GetTrajectory //Parses pathweaver json to create a series of points that we can drive the robot to
+void DrivePath::GetTrajectory //Looks up the pathweaver path; TrajectoryCache parsed it (and built its lookup table) at RobotInit
 (
     string  path
 )
 {
     if (!path.empty()) // only go if path name found
     {
-        Logger::GetLogger()->LogError(string("DrivePath" + m_pathname), string("Finding Deploy Directory"));
-
-        // Read path into trajectory for deploy directory.  JSON File ex. Bounce1.wpilid.json
-        wpi::SmallString<64> deployDir;  //creates a string variable
-        //frc::filesystem::GetDeployDirectory(deployDir);  //grabs the deploy directory: "/lvuser/deploy" on roborio
-        //wpi::sys::path::append(deployDir, "paths");  //goes into "/lvuser/deploy/paths" on roborio
-        //wpi::sys::path::append(deployDir, path); // load path from deploy directory
-        deployDir = "/users/lvuser/deploy/paths/" + m_pathname;
-      
-
-        Logger::GetLogger()->LogError(string("Deploy path is "), deployDir.c_str()); //Debugging
-        
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);  //Creates a trajectory or path that can be used in the code, parsed from pathweaver json
-        m_trajectoryStates = m_trajectory.States();  //Creates a vector of all the states or "waypoints" the robot needs to get to
-        
-        Logger::GetLogger()->LogError(string("DrivePath - Loaded = "), path);
-        Logger::GetLogger()->ToNtTable("DrivePathValues", "TrajectoryTotalTime", m_trajectory.TotalTime().to<double>());
+        m_path = TrajectoryCache::GetInstance()->GetPath(path);  //path is the json file name under deploy/paths, ex. Bounce1.wpilib.json
+        if (m_path.get() != nullptr)
+        {
+            Logger::GetLogger()->LogError(string("DrivePath - Loaded = "), path);
+            Logger::GetLogger()->ToNtTable("DrivePathValues", "TrajectoryTotalTime", m_path.get()->trajectory.TotalTime().to<double>());
+        }
     }
 }
 
 void DrivePath::CalcCurrentAndDesiredStates()
 {
-    m_currentChassisPosition = m_chassis.get()->GetPose(); //Grabs current pose / position
+    m_currentChassisPosition = VisionPoseEstimator::GetInstance()->GetEstimatedPose(); //Grabs current pose / position
     auto sampleTime = units::time::second_t(m_timer.get()->Get()); //+ 0.02  //Grabs the time that we should sample a state from
 
-    m_desiredState = m_trajectory.Sample(sampleTime); //Gets the target state based on the current time
+    m_desiredState = m_path.get()->table.Sample(sampleTime); //Gets the target state based on the current time
 
     // May need to do our own sampling based on position and time     
 
-    Logger::GetLogger()->ToNtTable("DrivePathValues", "DesiredPoseX", m_desiredState.pose.X().to<double>());
-    Logger::GetLogger()->ToNtTable("DrivePathValues", "DesiredPoseY", m_desiredState.pose.Y().to<double>());
-    Logger::GetLogger()->ToNtTable("DrivePathValues", "DesiredPoseOmega", m_desiredState.pose.Rotation().Degrees().to<double>());
-    Logger::GetLogger()->ToNtTable("DrivePathValues", "CurrentPosX", m_currentChassisPosition.X().to<double>());
-    Logger::GetLogger()->ToNtTable("DrivePathValues", "CurrentPosY", m_currentChassisPosition.Y().to<double>());
-    Logger::GetLogger()->ToNtTable("DrivePathValues", "CurrentPosOmega", m_desiredState.pose.Rotation().Degrees().to<double>());
-    Logger::GetLogger()->ToNtTable("DeltaValues", "DeltaX", m_desiredState.pose.X().to<double>() - m_currentChassisPosition.X().to<double>());
-    Logger::GetLogger()->ToNtTable("DeltaValues", "DeltaY", m_desiredState.pose.Y().to<double>() - m_currentChassisPosition.Y().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::DESIRED_POSE_X], m_desiredState.pose.X().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::DESIRED_POSE_Y], m_desiredState.pose.Y().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::DESIRED_POSE_OMEGA], m_desiredState.pose.Rotation().Degrees().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::CURRENT_POS_X], m_currentChassisPosition.X().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::CURRENT_POS_Y], m_currentChassisPosition.Y().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::CURRENT_POS_OMEGA], m_desiredState.pose.Rotation().Degrees().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::DELTA_X], m_desiredState.pose.X().to<double>() - m_currentChassisPosition.X().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::DELTA_Y], m_desiredState.pose.Y().to<double>() - m_currentChassisPosition.Y().to<double>());
 
-    Logger::GetLogger()->ToNtTable("DrivePathValues", "CurrentTime", m_timer.get()->Get().to<double>());
+    Logger::GetLogger()->ToNtTable(m_ntHandles[NT_VALUE::CURRENT_TIME], m_timer.get()->Get().to<double>());
 }
\ No newline at end of file
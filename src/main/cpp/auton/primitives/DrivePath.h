@@ -15,6 +15,7 @@
 #pragma once
 
 //C++ Includes
+#include <array>
 #include <memory>
 
 //Team302 Includes
@@ -37,6 +38,8 @@
 #include <frc/estimator/SwerveDrivePoseEstimator.h>
 
 #include <subsys/ChassisFactory.h>
+#include <auton/TrajectoryCache.h>
+#include <auton/TrajectoryGeneratorService.h>
 
 class SwerveChassis;
 
@@ -55,10 +58,33 @@ public:
     void Init(PrimitiveParams *params) override;
     void Run() override;
     bool IsDone() override;
+    bool InBlendWindow() override;
 
 private:
+    /// @brief values written to the network tables every loop; the handles are resolved up front
+    enum NT_VALUE
+    {
+        RUNNING,
+        TIMES_RAN,
+        CHASSIS_SPEEDS_X,
+        CHASSIS_SPEEDS_Y,
+        CHASSIS_SPEEDS_Z,
+        DESIRED_POSE_X,
+        DESIRED_POSE_Y,
+        DESIRED_POSE_OMEGA,
+        CURRENT_POS_X,
+        CURRENT_POS_Y,
+        CURRENT_POS_OMEGA,
+        DELTA_X,
+        DELTA_Y,
+        CURRENT_TIME,
+        MAX_NT_VALUE
+    };
+
     bool IsSamePose(frc::Pose2d, frc::Pose2d, double tolerance); // routine to check for motion
     void GetTrajectory(std::string  path);
+    void TakeGeneratedPath();
+    void StartPath();
     void CalcCurrentAndDesiredStates();
 
 
@@ -67,7 +93,8 @@ private:
     std::unique_ptr<frc::Timer>             m_timer;
 
     frc::Pose2d                             m_currentChassisPosition;
-    frc::Trajectory                         m_trajectory;
+    std::shared_ptr<const TrajectoryCache::CachedPath> m_path;  // trajectory and its 5 ms lookup table
+    TrajectoryGeneratorService::PathFuture  m_generatedPath;    // valid until the generated path is picked up
     bool                                    m_runHoloController;
     bool                                    m_wasMoving;
     frc::RamseteController                  m_ramseteController;
@@ -79,7 +106,8 @@ private:
     std::string                             m_pathname;
     double                                  m_deltaX;
     double                                  m_deltaY;
-    std::vector<frc::Trajectory::State>     m_trajectoryStates;
+    units::second_t                         m_blendTime;        // hand off to the next primitive this long before the path ends
     frc::Trajectory::State                  m_desiredState;
+    std::array<int, NT_VALUE::MAX_NT_VALUE> m_ntHandles;
  
 };
\ No newline at end of file
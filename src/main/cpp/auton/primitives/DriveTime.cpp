@@ -44,7 +44,9 @@ using namespace frc;
 
 DriveTime::DriveTime() :
 		SuperDrive(),
-		m_timeRemaining(0.0)       //Value will changed in init
+		m_timer( make_unique<Timer>() ),
+		m_maxTime(0.0),            //Value will changed in init
+		m_blendTime(0.0)
 
 {
 }
@@ -52,8 +54,11 @@ DriveTime::DriveTime() :
 void DriveTime::Init(PrimitiveParams* params) 
 {
 	SuperDrive::Init(params);
-	//Get timeRemaining from m_params
-	m_timeRemaining = params->GetTime();
+	//Get the drive time from m_params
+	m_maxTime = params->GetTime();
+	m_blendTime = params->GetBlendTime();
+	m_timer->Reset();
+	m_timer->Start();
 }
 
 void DriveTime::Run() 
@@ -64,6 +69,10 @@ void DriveTime::Run()
 
 bool DriveTime::IsDone() 
 {
-	m_timeRemaining -= LOOP_LENGTH;						// Decrement time remaining
-	return ((m_timeRemaining <= (LOOP_LENGTH / 2.0)));	// Return true when time runs out
+	return m_timer->HasElapsed( units::second_t(m_maxTime) );	// Return true when time runs out
+}
+
+bool DriveTime::InBlendWindow()
+{
+	return m_blendTime > 0.0 && m_timer->HasElapsed( units::second_t(m_maxTime - m_blendTime) );
 }
@@ -17,6 +17,7 @@
 #pragma once
 
 // C++ Includes
+#include <memory>
 
 // FRC includes
 
@@ -28,6 +29,10 @@
 //Team302 includes
 #include <auton/primitives/SuperDrive.h>
 
+namespace frc
+{
+	class Timer;
+}
 class PrimitiveParams;
 
 class DriveTime: public SuperDrive 
@@ -38,9 +43,12 @@ public:
 	void Init(PrimitiveParams* params) override;
 	void Run() override;
 	bool IsDone() override;
+	bool InBlendWindow() override;
 
 private:
-	float m_timeRemaining;          //In seconds
+	std::unique_ptr<frc::Timer> m_timer;
+	float m_maxTime;                //In seconds
+	float m_blendTime;              //In seconds
 
 };
 
@@ -19,6 +19,7 @@
 #include <string>
 
 // FRC includes
+#include <frc/Timer.h>
 
 // Team 302 includes
 #include <auton/PrimitiveFactory.h>
@@ -36,14 +37,17 @@ using namespace frc;
 
 HoldPosition::HoldPosition() :
 		m_chassis( ChassisFactory::GetChassisFactory()->GetIChassis()), //Get chassis from chassis factory
-		m_timeRemaining(0.0)       //Value will be changed in init
+		m_timer( make_unique<Timer>() ),
+		m_maxTime(0.0)             //Value will be changed in init
 {
 }
 
 void HoldPosition::Init(PrimitiveParams* params) {
 
-	//Get timeRemaining from m_params
-	m_timeRemaining = params->GetTime();
+	//Get the hold time from m_params
+	m_maxTime = params->GetTime();
+	m_timer->Reset();
+	m_timer->Start();
 	auto cd = make_shared<ControlData>( ControlModes::CONTROL_TYPE::POSITION_INCH, 
 							   			ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
 							   			string("HoldPosition"),
@@ -64,13 +68,9 @@ void HoldPosition::Init(PrimitiveParams* params) {
 }
 
 void HoldPosition::Run() {
-	//Decrement time remaining
-	m_timeRemaining -= IPrimitive::LOOP_LENGTH;
-
 }
 
 bool HoldPosition::IsDone() {
 	//Return true when the time runs out
-	bool holdDone = ((m_timeRemaining <= (IPrimitive::LOOP_LENGTH / 2.0)));
-	return holdDone;
+	return m_timer->HasElapsed( units::second_t(m_maxTime) );
 }
@@ -27,6 +27,10 @@
 
 #include <auton/primitives/IPrimitive.h>
 
+namespace frc
+{
+	class Timer;
+}
 class IChassis;
 class PrimitiveParams;
 
@@ -46,6 +50,7 @@ private:
 	const float kF = 0.0;
 	//Objects
 	std::shared_ptr<IChassis> m_chassis;
-	double m_timeRemaining; //In seconds
+	std::unique_ptr<frc::Timer> m_timer;
+	double m_maxTime; //In seconds
 };
 
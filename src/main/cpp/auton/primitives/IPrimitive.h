@@ -29,5 +29,10 @@ class IPrimitive
         virtual void Run() = 0;
         virtual bool IsDone() = 0;
 
+        /// @brief true once the primitive is within its blend window (PrimitiveParams::GetBlendTime) of
+        ///        finishing; the next primitive then starts while this one is still moving and this one
+        ///        is treated as done.  Only called when there is a next primitive.
+        virtual bool InBlendWindow() { return false; }
+
 };
 
@@ -20,15 +20,18 @@
 //Team 302 includes
 #include <auton/primitives/ResetPosition.h>
 #include <auton/PrimitiveParams.h>
+#include <auton/TrajectoryCache.h>
 #include <auton/primitives/IPrimitive.h>
 #include <subsys/ChassisFactory.h>
+#include <subsys/VisionPoseEstimator.h>
 #include <hw/factories/PigeonFactory.h>
 #include <utils/Logger.h>
 
 using namespace std;
 using namespace frc;
 
-ResetPosition::ResetPosition() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChassis())
+ResetPosition::ResetPosition() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChassis()),
+                                 m_path()
 {
 }
 
@@ -38,24 +41,22 @@ void ResetPosition::Init(PrimitiveParams* params)
 
     if (pathToLoad != "")
     {
-        wpi::SmallString<64> deployDir;
-        deployDir = "/users/lvuser/deploy/paths/" + pathToLoad;
-        //wpi::SmallString<64> deployDir;
-        //frc::filesystem::GetDeployDirectory(deployDir);
-        //wpi::sys::path::append(deployDir, "paths");
-        //wpi::sys::path::append(deployDir, pathToLoad);
-
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);
+        m_path = TrajectoryCache::GetInstance()->GetPath(pathToLoad);  //preloaded at RobotInit
+        if (m_path.get() == nullptr)
+        {
+            return;
+        }
+        auto& trajectory = m_path.get()->trajectory;
 
         frc::Rotation2d StartAngle;
-        StartAngle.Degrees() = (m_trajectory.InitialPose().Rotation().Degrees() + units::degree_t(180));
+        StartAngle.Degrees() = (trajectory.InitialPose().Rotation().Degrees() + units::degree_t(180));
 
-        m_chassis->ResetPose(m_trajectory.InitialPose());
+        VisionPoseEstimator::GetInstance()->ResetPose(trajectory.InitialPose());   // also resets the chassis odometry
 
         Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "ResetPosX", to_string(m_chassis.get()->GetPose().X().to<double>()));
         Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "ResetPosY", to_string(m_chassis.get()->GetPose().Y().to<double>()));
-        Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "InitialPoseX", to_string(m_trajectory.InitialPose().X().to<double>()));
-        Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "InitialPoseY", to_string(m_trajectory.InitialPose().Y().to<double>()));
+        Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "InitialPoseX", to_string(trajectory.InitialPose().X().to<double>()));
+        Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "InitialPoseY", to_string(trajectory.InitialPose().Y().to<double>()));
         
     }
 }
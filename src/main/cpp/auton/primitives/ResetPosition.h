@@ -26,6 +26,7 @@
 
 //Team 302 Includes
 #include <auton/primitives/IPrimitive.h>
+#include <auton/TrajectoryCache.h>
 
 //Forward Declares
 class IChassis;
@@ -46,5 +47,5 @@ class ResetPosition : public IPrimitive
     
     private:
         std::shared_ptr<IChassis> m_chassis;
-        frc::Trajectory                m_trajectory;
+        std::shared_ptr<const TrajectoryCache::CachedPath> m_path;
 };
\ No newline at end of file
@@ -22,6 +22,7 @@
 // Team 302 includes
 
 // Third Party Includes
+#include <cmath>
 #include <string>
 #include <frc/GenericHID.h>
 #include <gamepad/IDragonGamePad.h>
@@ -58,8 +59,15 @@ TeleopControl::TeleopControl() : m_axisIDs(),
 								 m_buttonIDs(),
 								 m_controllerIndex(),
 								 m_controllers(),
-								 m_count( 0 )
+								 m_count( 0 ),
+								 m_subscribed(),
+								 m_buttonStates(),
+								 m_axisStates(),
+								 m_events(),
+								 m_reportAll( true )
 {
+	m_events.reserve( FUNCTION_IDENTIFIER::MAX_FUNCTIONS );	// each function reports one event a loop at most
+
 	for ( int inx=0; inx<DriverStation::kJoystickPorts; ++inx )
 	{
 		m_controllers[inx] = nullptr;
@@ -94,6 +102,8 @@ TeleopControl::TeleopControl() : m_axisIDs(),
 		m_axisIDs[ ARCADE_THROTTLE]         = IDragonGamePad::LEFT_JOYSTICK_Y;
 		m_controllerIndex[ARCADE_STEER]     = ctrlNo;
 		m_axisIDs[ARCADE_STEER]             = IDragonGamePad::RIGHT_JOYSTICK_X;
+		m_controllerIndex[ARCADE_STRAFE]    = ctrlNo;
+		m_axisIDs[ARCADE_STRAFE]            = IDragonGamePad::LEFT_JOYSTICK_X;
 
 		m_controllerIndex[INTAKE]           = ctrlNo;
 		m_buttonIDs[INTAKE]                 = IDragonGamePad::RIGHT_BUMPER;
@@ -291,4 +301,67 @@ bool TeleopControl::IsButtonPressed
     return isSelected;
 }
 
+//------------------------------------------------------------------
+// Method:      Subscribe
+// Description: Have Update sample the function's button/axis and
+//              report its events
+// Returns:     void
+//------------------------------------------------------------------
+void TeleopControl::Subscribe
+(
+    TeleopControl::FUNCTION_IDENTIFIER  function    // <I> - function to report
+)
+{
+    m_subscribed.set( function );
+}
 
+//------------------------------------------------------------------
+// Method:      Update
+// Description: Call once per loop before the inputs are used.
+//              Samples each subscribed function once and builds
+//              this loop's list of input events.
+// Returns:     void
+//------------------------------------------------------------------
+void TeleopControl::Update()
+{
+    m_events.clear();
+    for ( int inx=0; inx<FUNCTION_IDENTIFIER::MAX_FUNCTIONS; ++inx )
+    {
+        if ( !m_subscribed.test( inx ) )
+        {
+            continue;
+        }
+
+        auto function = static_cast<FUNCTION_IDENTIFIER>( inx );
+        if ( m_buttonIDs[inx] != IDragonGamePad::BUTTON_IDENTIFIER::UNDEFINED_BUTTON )
+        {
+            auto pressed = IsButtonPressed( function );
+            if ( pressed != m_buttonStates[inx] || m_reportAll )
+            {
+                m_buttonStates[inx] = pressed;
+                m_events.emplace_back( InputEvent{ function, pressed ? INPUT_EVENT_TYPE::PRESSED : INPUT_EVENT_TYPE::RELEASED } );
+            }
+        }
+        else if ( m_axisIDs[inx] != IDragonGamePad::AXIS_IDENTIFIER::UNDEFINED_AXIS )
+        {
+            auto crossed = abs( GetAxisValue( function ) ) >= AXIS_EVENT_THRESHOLD;
+            if ( crossed != m_axisStates[inx] || m_reportAll )
+            {
+                m_axisStates[inx] = crossed;
+                m_events.emplace_back( InputEvent{ function, INPUT_EVENT_TYPE::AXIS_CROSSED } );
+            }
+        }
+    }
+    m_reportAll = false;
+}
+
+//------------------------------------------------------------------
+// Method:      ResetInputEvents
+// Description: The next Update reports every subscribed function's
+//              current state as an event (e.g. when teleop starts)
+// Returns:     void
+//------------------------------------------------------------------
+void TeleopControl::ResetInputEvents()
+{
+    m_reportAll = true;
+}
@@ -17,8 +17,11 @@
 #pragma once 
 
 // C++ Includes
+#include <array>
+#include <bitset>
 #include <memory>
 #include <map>
+#include <vector>
 
 
 // FRC includes
@@ -40,6 +43,7 @@ class TeleopControl
             UNKNOWN_FUNCTION,
             ARCADE_THROTTLE,
             ARCADE_STEER,
+            ARCADE_STRAFE,
             INTAKE,
             EXPEL,
             ROTATE_ARM_UP,
@@ -48,6 +52,25 @@ class TeleopControl
             MAX_FUNCTIONS
         };
 
+        /// @brief input changes reported by Update
+        enum INPUT_EVENT_TYPE
+        {
+            PRESSED,
+            RELEASED,
+            AXIS_CROSSED        // axis moved past AXIS_EVENT_THRESHOLD either way (or back)
+        };
+
+        struct InputEvent
+        {
+            FUNCTION_IDENTIFIER     function;
+            INPUT_EVENT_TYPE        type;
+        };
+
+        static constexpr double AXIS_EVENT_THRESHOLD = 0.5;
+
+        /// @brief  button states sampled by Update, indexed by FUNCTION_IDENTIFIER
+        using ButtonStates = std::array<bool, MAX_FUNCTIONS>;
+
 
         //----------------------------------------------------------------------------------
         // Method:      GetInstance
@@ -114,6 +137,47 @@ class TeleopControl
         ) const;
 
 
+        //------------------------------------------------------------------
+        // Method:      Subscribe
+        // Description: Have Update sample the function's button/axis and
+        //              report its events
+        // Returns:     void
+        //------------------------------------------------------------------
+        void Subscribe
+        (
+            TeleopControl::FUNCTION_IDENTIFIER function // <I> - function to report
+        );
+
+        //------------------------------------------------------------------
+        // Method:      Update
+        // Description: Call once per loop before the inputs are used.
+        //              Samples each subscribed function once and builds
+        //              this loop's list of input events.
+        // Returns:     void
+        //------------------------------------------------------------------
+        void Update();
+
+        //------------------------------------------------------------------
+        // Method:      ResetInputEvents
+        // Description: The next Update reports every subscribed function's
+        //              current state as an event (e.g. when teleop starts)
+        // Returns:     void
+        //------------------------------------------------------------------
+        void ResetInputEvents();
+
+        /// @brief  input events found by the last Update
+        inline const std::vector<InputEvent>& GetInputEvents() const { return m_events; };
+
+        /// @brief  button state sampled by the last Update (subscribed functions only)
+        inline bool GetButtonState
+        (
+            TeleopControl::FUNCTION_IDENTIFIER button
+        ) const { return m_buttonStates[button]; };
+
+        /// @brief  every button state sampled by the last Update; the state manager guards check this snapshot
+        inline const ButtonStates& GetButtonStates() const { return m_buttonStates; };
+
+
     private:
         //----------------------------------------------------------------------------------
         // Method:      OperatorInterface <<constructor>>
@@ -143,5 +207,11 @@ class TeleopControl
         IDragonGamePad*			            m_controllers[frc::DriverStation::kJoystickPorts];
 
         mutable int                         m_count;
+
+        std::bitset<MAX_FUNCTIONS>          m_subscribed;       // functions Update samples
+        ButtonStates                        m_buttonStates;     // as of the last Update
+        std::array<bool, MAX_FUNCTIONS>     m_axisStates;       // past AXIS_EVENT_THRESHOLD as of the last Update
+        std::vector<InputEvent>             m_events;           // this loop's events
+        bool                                m_reportAll;
 };
 
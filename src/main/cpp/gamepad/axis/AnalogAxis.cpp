@@ -62,12 +62,23 @@ AnalogAxis::AnalogAxis
     m_axis( axisID ),
     m_profile( LinearProfile::GetInstance() ),  
     m_deadband( NoDeadbandValue::GetInstance() ), 
-    m_scale( new ScaledAxis()  )
+    m_scale( new ScaledAxis()  ),
+    m_rawHandle( Logger::INVALID_NT_HANDLE ),
+    m_deadbandHandle( Logger::INVALID_NT_HANDLE ),
+    m_profileHandle( Logger::INVALID_NT_HANDLE ),
+    m_scaleHandle( Logger::INVALID_NT_HANDLE )
 {
     if ( flipAxis )
     {
         m_scale->SetScaleFactor( -1.0 );
     }
+
+    auto ntName = string("Axis - ");
+    ntName += to_string(m_axis);
+    m_rawHandle      = Logger::GetLogger()->RegisterNtEntry(ntName, "raw value");
+    m_deadbandHandle = Logger::GetLogger()->RegisterNtEntry(ntName, "after deadband");
+    m_profileHandle  = Logger::GetLogger()->RegisterNtEntry(ntName, "after profile");
+    m_scaleHandle    = Logger::GetLogger()->RegisterNtEntry(ntName, "after scale");
 }
 
 //================================================================================================
@@ -81,17 +92,14 @@ double AnalogAxis::GetAxisValue()
 
     if ( m_gamepad != nullptr )
     {
-        auto ntName = string("Axis - ");
-        ntName += to_string(m_axis);
-
         value = GetRawValue();
-        Logger::GetLogger()->ToNtTable(ntName, "raw value", value );
+        Logger::GetLogger()->ToNtTable(m_rawHandle, value );
         value = m_deadband->ApplyDeadband( value );
-        Logger::GetLogger()->ToNtTable(ntName, "after deadband", value );
+        Logger::GetLogger()->ToNtTable(m_deadbandHandle, value );
         value = m_profile->ApplyProfile( value );
-        Logger::GetLogger()->ToNtTable(ntName, "after profile", value );
+        Logger::GetLogger()->ToNtTable(m_profileHandle, value );
         value = m_scale->Scale( value );
-        Logger::GetLogger()->ToNtTable(ntName, "after scale", value );
+        Logger::GetLogger()->ToNtTable(m_scaleHandle, value );
    }
     else
     {
@@ -110,4 +110,10 @@ class AnalogAxis
         IProfile*                           m_profile;
         IDeadband*                          m_deadband;
         ScaledAxis*                         m_scale;
+
+        // network table handles for the per-loop axis telemetry
+        int                                 m_rawHandle;
+        int                                 m_deadbandHandle;
+        int                                 m_profileHandle;
+        int                                 m_scaleHandle;
 };
@@ -0,0 +1,252 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// CanBusScheduler.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Picks the status frame priority for every motor controller and the pigeon.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <chrono>
+#include <cmath>
+#include <string>
+
+// FRC includes
+#include <frc/DriverStation.h>
+#include <frc/RobotController.h>
+
+// Team 302 includes
+#include <hw/CanBusScheduler.h>
+#include <hw/DragonPigeon.h>
+#include <hw/factories/DragonMotorControllerFactory.h>
+#include <hw/factories/PigeonFactory.h>
+#include <hw/usages/MotorControllerUsage.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+#include <ctre/phoenix/Sensors/PigeonIMU.h>
+
+using namespace std;
+using namespace ctre::phoenix::sensors;
+
+CanBusScheduler* CanBusScheduler::m_instance = nullptr;
+CanBusScheduler* CanBusScheduler::GetInstance()
+{
+    if ( CanBusScheduler::m_instance == nullptr )
+    {
+        CanBusScheduler::m_instance = new CanBusScheduler();
+    }
+    return CanBusScheduler::m_instance;
+}
+
+CanBusScheduler::CanBusScheduler() : m_budget( DEFAULT_UTILIZATION_BUDGET ),
+                                     m_pathFollowing( false ),
+                                     m_overBudget( false ),
+                                     m_lastUpdate(),
+                                     m_priority(),
+                                     m_lastActive(),
+                                     m_pigeonPriority( NO_PRIORITY ),
+                                     m_ntUtilizationHandle( Logger::INVALID_NT_HANDLE ),
+                                     m_ntOverBudgetHandle( Logger::INVALID_NT_HANDLE )
+{
+    m_priority.fill( NO_PRIORITY );
+
+    auto logger = Logger::GetLogger();
+    m_ntUtilizationHandle = logger->RegisterNtEntry( string("CanBusScheduler"), string("utilization") );
+    m_ntOverBudgetHandle  = logger->RegisterNtEntry( string("CanBusScheduler"), string("over budget") );
+}
+
+void CanBusScheduler::SetPathFollowing
+(
+    bool    following
+)
+{
+    if ( following != m_pathFollowing )
+    {
+        m_pathFollowing = following;
+        m_lastUpdate = chrono::steady_clock::time_point();  // re-evaluate on the next loop
+    }
+}
+
+void CanBusScheduler::SetUtilizationBudget
+(
+    double  budget
+)
+{
+    if ( budget > 0.0 && budget <= 1.0 )
+    {
+        m_budget = budget;
+    }
+    else
+    {
+        Logger::GetLogger()->LogError( string("CanBusScheduler::SetUtilizationBudget"), string("budget must be between 0.0 and 1.0: ") + to_string(budget) );
+    }
+}
+
+void CanBusScheduler::Periodic()
+{
+    auto now = chrono::steady_clock::now();
+    auto factory = DragonMotorControllerFactory::GetInstance();
+
+    // track activity every loop so short bursts of output aren't missed between updates
+    for ( auto inx=0; inx<NUM_CAN_IDS; ++inx )
+    {
+        auto& data = factory->GetSensorData( inx );
+        if ( data.valid && abs( data.output ) > IDLE_OUTPUT )
+        {
+            m_lastActive[inx] = now;
+        }
+    }
+
+    if ( ( now - m_lastUpdate ) < UPDATE_PERIOD )
+    {
+        return;
+    }
+    m_lastUpdate = now;
+
+    auto utilization = static_cast<double>( frc::RobotController::GetCANStatus().percentBusUtilization );
+    if ( utilization > m_budget )
+    {
+        m_overBudget = true;
+    }
+    else if ( utilization < m_budget - BUDGET_HYSTERESIS )
+    {
+        m_overBudget = false;
+    }
+
+    auto logger = Logger::GetLogger();
+    logger->ToNtTable( m_ntUtilizationHandle, utilization );
+    logger->ToNtTable( m_ntOverBudgetHandle, m_overBudget ? 1.0 : 0.0 );
+
+    auto enabled = frc::DriverStation::IsEnabled();
+    if ( !enabled )
+    {
+        m_pathFollowing = false;
+    }
+
+    for ( auto inx=0; inx<NUM_CAN_IDS; ++inx )
+    {
+        auto controller = factory->GetController( inx );
+        if ( controller.get() != nullptr )
+        {
+            auto priority = GetPriority( controller.get()->GetType(), inx, enabled, now );
+            if ( priority != m_priority[inx] )
+            {
+                controller.get()->SetFramePeriodPriority( priority );
+                m_priority[inx] = priority;
+            }
+        }
+    }
+
+    auto pigeonPriority = IDragonMotorController::MOTOR_PRIORITY::LOW;
+    if ( enabled )
+    {
+        pigeonPriority = IDragonMotorController::MOTOR_PRIORITY::ODOMETRY;    // the odometry heading
+    }
+    UpdatePigeon( pigeonPriority );
+}
+
+IDragonMotorController::MOTOR_PRIORITY CanBusScheduler::GetPriority
+(
+    MotorControllerUsage::MOTOR_CONTROLLER_USAGE    usage,
+    int                                             canID,
+    bool                                            enabled,
+    chrono::steady_clock::time_point                now
+)
+{
+    if ( !enabled )
+    {
+        return IDragonMotorController::MOTOR_PRIORITY::LOW;
+    }
+
+    switch ( usage )
+    {
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_DRIVE:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_LEFT_DRIVE:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_RIGHT_DRIVE:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_LEFT_DRIVE:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_RIGHT_DRIVE:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_FRONT_LEFT:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_FRONT_RIGHT:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_BACK_LEFT:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_BACK_RIGHT:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_LEFT_MAIN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_RIGHT_MAIN:
+            // the odometry notifier reads these every ODOMETRY_FEEDBACK_PERIOD_MS, so they don't back off
+            return IDragonMotorController::MOTOR_PRIORITY::ODOMETRY;
+
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_TURN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_LEFT_TURN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_RIGHT_TURN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_LEFT_TURN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_RIGHT_TURN:
+            if ( m_pathFollowing )
+            {
+                return IDragonMotorController::MOTOR_PRIORITY::HIGH;
+            }
+            return m_overBudget ? IDragonMotorController::MOTOR_PRIORITY::LOW : IDragonMotorController::MOTOR_PRIORITY::MEDIUM;
+
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_LEFT_FOLLOWER:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_RIGHT_FOLLOWER:
+            // followers mirror their master, nothing reads their feedback
+            return IDragonMotorController::MOTOR_PRIORITY::LOW;
+
+        default:
+            break;
+    }
+
+    auto active = ( now - m_lastActive[canID] ) < IDLE_TIME;
+    return ( active && !m_overBudget ) ? IDragonMotorController::MOTOR_PRIORITY::MEDIUM : IDragonMotorController::MOTOR_PRIORITY::LOW;
+}
+
+void CanBusScheduler::UpdatePigeon
+(
+    IDragonMotorController::MOTOR_PRIORITY          priority
+)
+{
+    auto pigeon = PigeonFactory::GetFactory()->GetPigeon();
+    if ( pigeon == nullptr || priority == m_pigeonPriority )
+    {
+        return;
+    }
+
+    uint8_t period = 100;
+    switch ( priority )
+    {
+        case IDragonMotorController::MOTOR_PRIORITY::ODOMETRY:
+            period = IDragonMotorController::ODOMETRY_FEEDBACK_PERIOD_MS;
+            break;
+
+        case IDragonMotorController::MOTOR_PRIORITY::HIGH:
+            period = 10;
+            break;
+
+        case IDragonMotorController::MOTOR_PRIORITY::MEDIUM:
+            period = 20;
+            break;
+
+        default:
+            break;
+    }
+    pigeon->UpdateFramePeriods( PigeonIMU_StatusFrame::PigeonIMU_CondStatus_9_SixDeg_YPR, period );
+    pigeon->UpdateFramePeriods( PigeonIMU_StatusFrame::PigeonIMU_CondStatus_6_SensorFusion, period );
+    m_pigeonPriority = priority;
+}
@@ -0,0 +1,115 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// CanBusScheduler.h
+//========================================================================================================
+///
+/// File Description:
+///     Picks the status frame priority for every motor controller and the pigeon from what the robot
+///     is doing:
+///         - disabled:         everything LOW
+///         - enabled:          drive motors and the pigeon ODOMETRY (feedback as fast as the 
+///                             chassis odometry notifier reads it)
+///         - following a path: other chassis motors HIGH
+///         - enabled:          other chassis motors MEDIUM, active mechanism motors MEDIUM, idle ones LOW
+///     When the CAN bus utilization goes over the budget, everything that isn't following a path or
+///     feeding the odometry drops to LOW until utilization is back under the budget.  Frame periods are only sent to a 
+///     device when its priority changes.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <chrono>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/interfaces/IDragonMotorController.h>
+
+// Third Party Includes
+
+
+class CanBusScheduler
+{
+    public:
+        /// @brief Find or create the scheduler
+        /// @returns CanBusScheduler* pointer to the scheduler
+        static CanBusScheduler* GetInstance();
+
+        /// @brief re-evaluate the frame priorities; call once per loop after the sensors are refreshed
+        void Periodic();
+
+        /// @brief the chassis is (or is no longer) following a trajectory and needs fast feedback
+        /// @param [in] bool following - true while a path is being followed
+        void SetPathFollowing
+        (
+            bool    following
+        );
+
+        /// @brief set the fraction of the CAN bus (0.0 to 1.0) the status frames may use before backing off
+        /// @param [in] double budget - utilization budget
+        void SetUtilizationBudget
+        (
+            double  budget
+        );
+
+        inline double GetUtilizationBudget() const { return m_budget; }
+
+        static constexpr double DEFAULT_UTILIZATION_BUDGET = 0.70;
+
+    private:
+        CanBusScheduler();
+        ~CanBusScheduler() = default;
+
+        /// @brief priority for one motor controller
+        IDragonMotorController::MOTOR_PRIORITY GetPriority
+        (
+            MotorControllerUsage::MOTOR_CONTROLLER_USAGE    usage,
+            int                                             canID,
+            bool                                            enabled,
+            std::chrono::steady_clock::time_point           now
+        );
+
+        void UpdatePigeon
+        (
+            IDragonMotorController::MOTOR_PRIORITY          priority
+        );
+
+        static CanBusScheduler*                                         m_instance;
+
+        static constexpr int                                            NUM_CAN_IDS = 63;
+        static constexpr int                                            NO_PRIORITY = -1;
+        static constexpr double                                         IDLE_OUTPUT = 0.01;
+        static constexpr double                                         BUDGET_HYSTERESIS = 0.10;
+        static constexpr std::chrono::milliseconds                      UPDATE_PERIOD{250};
+        static constexpr std::chrono::milliseconds                      IDLE_TIME{1000};
+
+        double                                                          m_budget;
+        bool                                                            m_pathFollowing;
+        bool                                                            m_overBudget;
+        std::chrono::steady_clock::time_point                           m_lastUpdate;
+        std::array<int, NUM_CAN_IDS>                                    m_priority;     // last priority sent to each controller
+        std::array<std::chrono::steady_clock::time_point, NUM_CAN_IDS>  m_lastActive;   // last time each controller had output
+        int                                                             m_pigeonPriority;
+
+        int                                                             m_ntUtilizationHandle;
+        int                                                             m_ntOverBudgetHandle;
+};
@@ -20,6 +20,7 @@
 
 // C++ Includes
 #include <memory>
+#include <string>
 #include <vector>
 
 // FRC includes
@@ -29,6 +30,7 @@
 #include <hw/DragonFalcon.h>
 //#include <hw/DragonPDP.h>
 #include <hw/usages/MotorControllerUsage.h>
+#include <hw/DragonOutputCache.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <utils/Logger.h>
 #include <controllers/ControlModes.h>
@@ -68,6 +70,7 @@ class DragonFalcon : public IDragonMotorController
         void SetControlMode(ControlModes::CONTROL_TYPE mode) override; //:D
         void Set(double value) override;
         void Set(std::shared_ptr<nt::NetworkTable> nt, double value) override;
+        void SetWithFeedForward(double value, double arbFeedForward) override;
         void SetRotationOffset(double rotations) override;
         void SetVoltageRamping(double ramping, double rampingClosedLoop = -1) override; // seconds 0 to full, set to 0 to disable
         void EnableCurrentLimiting(bool enabled) override; 
@@ -135,8 +138,29 @@ class DragonFalcon : public IDragonMotorController
         ) override;
 
         double GetGearRatio() const override { return m_gearRatio;}
+        uint64_t GetSuppressedWrites() const override { return m_outputCache.GetSuppressedCount(); }
+        void ReadSensors( MotorSensorData& data ) const override;
+        void UseSensorSnapshot( const MotorSensorData* data ) override { m_sensors = data; }
 
     private:
+        /// @brief  Convert the value to controller units for the current control mode and send it
+        /// @param [in] std::shared_ptr<nt::NetworkTable> nt - table the motor output is logged to
+        /// @param [in] double value - output in the units of the current control mode
+        /// @param [in] double arbFeedForward - percent output feed forward (0.0 for none)
+        void SetOutput
+        (
+            std::shared_ptr<nt::NetworkTable>   nt,
+            double                              value,
+            double                              arbFeedForward
+        );
+
+        /// @brief  Resolve the network table handles Set() writes to for the given table
+        /// @param [in] std::shared_ptr<nt::NetworkTable> nt - table the motor output is logged to
+        void RegisterNtHandles
+        (
+            std::shared_ptr<nt::NetworkTable> nt
+        );
+
         std::shared_ptr<ctre::phoenix::motorcontrol::can::WPI_TalonFX>  m_talon;
         ControlModes::CONTROL_TYPE m_controlMode;
         MotorControllerUsage::MOTOR_CONTROLLER_USAGE m_type;
@@ -148,5 +172,22 @@ class DragonFalcon : public IDragonMotorController
         double m_gearRatio;
 		double m_diameter;
 
+        std::shared_ptr<nt::NetworkTable> m_motorOutputTable;   // MotorOutput<id> table used by Set(double)
+        std::string m_ntPath;                                   // table the Set() handles are registered against
+        int m_ntMotorIdHandle;
+        int m_ntTargetVoltageHandle;
+        int m_ntTargetOutputHandle;
+        int m_ntPercentOutputHandle;
+        int m_ntRPSHandle;
+        int m_ntControlModeHandle;
+        int m_ntVoltageHandle;
+        int m_motorOutputPercentHandle;
+        int m_motorOutputRPSHandle;
+        int m_motorOutputVoltageHandle;
+        int m_ntSuppressedHandle;
+
+        DragonOutputCache m_outputCache;                        // last command sent, used to skip repeated writes
+        const MotorSensorData* m_sensors;                       // per loop sample (owned by DragonMotorControllerFactory)
+
 };
 
@@ -149,7 +149,13 @@ units::angle::degree_t DragonLimelight::GetTargetSkew() const
 
 units::time::microsecond_t DragonLimelight::GetPipelineLatency() const
 {
-    return units::time::second_t(m_networktable.get()->GetNumber("tl", 0.0));
+    return units::time::millisecond_t(m_networktable.get()->GetNumber("tl", 0.0));
+}
+
+units::time::second_t DragonLimelight::GetFrameTimestamp() const
+{
+    // the limelight publishes tl with every frame, so its last change identifies the frame
+    return units::time::microsecond_t(static_cast<double>(m_networktable.get()->GetEntry("tl").GetLastChange()));
 }
 
 
@@ -96,6 +96,7 @@ class DragonLimelight //: public IDragonSensor, public IDragonDistanceSensor
         double GetTargetArea() const;
         units::angle::degree_t GetTargetSkew() const;
         units::time::microsecond_t GetPipelineLatency() const;
+        units::time::second_t GetFrameTimestamp() const;    // when the latest frame was published (FPGA time)
         units::length::inch_t EstimateTargetDistance() const;
         std::vector<double> Get3DSolve() const;
 
@@ -147,6 +148,7 @@ class DragonLimelight //: public IDragonSensor, public IDragonDistanceSensor
         units::angle::degree_t GetMountingAngle() const {return m_mountingAngle;}
         units::length::inch_t  GetMountingHeight() const {return m_mountHeight;}
         units::length::inch_t  GetTargetHeight() const {return m_targetHeight;}
+        units::length::inch_t  GetMountingHorizontalOffset() const {return m_mountingHorizontalOffset;}
 
     private:
         std::shared_ptr<nt::NetworkTable> m_networktable;
@@ -0,0 +1,79 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// DragonOutputCache.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Suppresses motor controller writes that repeat the last command.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/DragonOutputCache.h>
+
+// Third Party Includes
+
+using namespace std;
+
+DragonOutputCache::DragonOutputCache() : m_valid( false ),
+                                         m_mode( 0 ),
+                                         m_output( 0.0 ),
+                                         m_feedForward( 0.0 ),
+                                         m_lastSent(),
+                                         m_suppressed( 0 )
+{
+}
+
+bool DragonOutputCache::ShouldSend
+(
+    int     mode,
+    double  output,
+    double  feedForward
+)
+{
+    auto now = chrono::steady_clock::now();
+    if ( m_valid && mode == m_mode && ( now - m_lastSent ) < KEEP_ALIVE_PERIOD )
+    {
+        auto tolerance = max( ABS_TOLERANCE, REL_TOLERANCE * abs( m_output ) );
+        if ( abs( output - m_output ) <= tolerance && abs( feedForward - m_feedForward ) <= ABS_TOLERANCE )
+        {
+            m_suppressed++;
+            return false;
+        }
+    }
+
+    m_valid    = true;
+    m_mode     = mode;
+    m_output   = output;
+    m_feedForward = feedForward;
+    m_lastSent = now;
+    return true;
+}
+
+void DragonOutputCache::Invalidate()
+{
+    m_valid = false;
+}
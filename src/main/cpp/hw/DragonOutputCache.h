@@ -0,0 +1,78 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// DragonOutputCache.h
+//========================================================================================================
+///
+/// File Description:
+///     Remembers the last control mode and output a motor controller was sent so the same command
+///     isn't pushed to the controller every loop.  Matching commands are suppressed until the 
+///     keep-alive period expires, then resent so the controller (and motor safety) stay fed.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <chrono>
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class DragonOutputCache
+{
+    public:
+        DragonOutputCache();
+        ~DragonOutputCache() = default;
+
+        /// @brief decide whether a command needs to be sent; if it does, it is recorded as the last command sent
+        /// @param [in] int     mode - controller specific control mode the output is for
+        /// @param [in] double  output - output in controller units
+        /// @param [in] double  feedForward - arbitrary feed forward sent with the output
+        /// @returns bool true if the caller should write the command to the controller
+        bool ShouldSend
+        (
+            int     mode,
+            double  output,
+            double  feedForward = 0.0
+        );
+
+        /// @brief forget the last command so the next one is always sent (e.g. after the controller 
+        ///        was commanded outside of Set())
+        void Invalidate();
+
+        /// @brief number of writes skipped because they matched the last command
+        uint64_t GetSuppressedCount() const { return m_suppressed; }
+
+        static constexpr double ABS_TOLERANCE = 0.0001;
+        static constexpr double REL_TOLERANCE = 0.0001;
+        static constexpr std::chrono::milliseconds KEEP_ALIVE_PERIOD{50};
+
+    private:
+        bool                                    m_valid;
+        int                                     m_mode;
+        double                                  m_output;
+        double                                  m_feedForward;
+        std::chrono::steady_clock::time_point   m_lastSent;
+        uint64_t                                m_suppressed;
+};
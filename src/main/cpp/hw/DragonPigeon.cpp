@@ -57,6 +57,15 @@ void DragonPigeon::ReZeroPigeon( double angleDeg, int timeoutMs)
     m_pigeon.get()->SetFusedHeading( angleDeg, timeoutMs);
 }
 
+void DragonPigeon::UpdateFramePeriods
+(
+    PigeonIMU_StatusFrame   frame,
+    uint8_t                 milliseconds
+)
+{
+    m_pigeon.get()->SetStatusFramePeriod( frame, milliseconds, 0 );
+}
+
 double DragonPigeon::GetRawPitch()
 {
     double ypr[3]; // yaw = 0 pitch = 1 roll = 2
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <ctre/phoenix/Sensors/PigeonIMU.h>
 
@@ -35,6 +36,15 @@ class DragonPigeon
         double GetYaw();
         void ReZeroPigeon( double angleDeg, int timeoutMs = 0);
 
+        /// @brief change how often the pigeon sends a status frame
+        /// @param [in] PigeonIMU_StatusFrame frame - status frame to change
+        /// @param [in] uint8_t milliseconds - period between frames
+        void UpdateFramePeriods
+        (
+            ctre::phoenix::sensors::PigeonIMU_StatusFrame   frame,
+            uint8_t                                         milliseconds
+        );
+
     private:
 
         std::unique_ptr<ctre::phoenix::sensors::PigeonIMU> m_pigeon;
@@ -15,6 +15,7 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -28,6 +29,7 @@
 // Team 302 includes
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/DragonTalon.h>
+#include <hw/DragonTalonConfig.h>
 //#include <hw/DragonPDP.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <utils/ConversionUtils.h>
@@ -35,6 +37,7 @@
 
 // Third Party Includes
 #include <ctre/phoenix/motorcontrol/can/WPI_TalonSRX.h>
+#include <ctre/phoenix/motorcontrol/DemandType.h>
 #include <ctre/phoenix/motorcontrol/SupplyCurrentLimitConfiguration.h>
 #include <ctre/phoenix/motorcontrol/LimitSwitchType.h>
 
@@ -61,231 +64,69 @@ DragonTalon::DragonTalon
 	m_countsPerRev(countsPerRev),
 	m_tickOffset(0),
 	m_gearRatio(gearRatio),
-	m_diameter( 1.0 )
+	m_diameter( 1.0 ),
+	m_motorOutputTable(),
+	m_ntPath(),
+	m_ntMotorIdHandle( Logger::INVALID_NT_HANDLE ),
+	m_ntTargetVoltageHandle( Logger::INVALID_NT_HANDLE ),
+	m_ntTargetOutputHandle( Logger::INVALID_NT_HANDLE ),
+	m_ntPercentOutputHandle( Logger::INVALID_NT_HANDLE ),
+	m_ntRPSHandle( Logger::INVALID_NT_HANDLE ),
+	m_ntSuppressedHandle( Logger::INVALID_NT_HANDLE ),
+	m_outputCache(),
+	m_sensors( nullptr )
 {
-	// for all calls if we get an error log it; for key items try again
+	auto start = chrono::steady_clock::now();
+
+	// build the whole configuration and send it at once rather than a blocking Config call per setting
 	auto prompt = string("Dragon Talon");
 	prompt += to_string(deviceID);
-	auto error = m_talon.get()->ConfigFactoryDefault();
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigFactoryDefault();
-		Logger::GetLogger()->LogError(prompt, string("ConfigFactoryDefault error"));
-		error = ErrorCode::OKAY;
-	}
-
-	m_talon.get()->SetNeutralMode(NeutralMode::Brake);
-
-	error = m_talon.get()->ConfigNeutralDeadband(0.01, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigNeutralDeadband error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigNominalOutputForward(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigNominalOutputForward(0.0, 0);
-		Logger::GetLogger()->LogError(prompt, string("ConfigNominalOutputForward error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigNominalOutputReverse(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigNominalOutputReverse(0.0, 0);
-		Logger::GetLogger()->LogError(prompt, string("ConfigNominalOutputReverse error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigOpenloopRamp(1.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigOpenloopRamp error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigPeakOutputForward(1.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigPeakOutputForward(1.0, 0);
-		Logger::GetLogger()->LogError(prompt, string("ConfigPeakOutputForward error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigPeakOutputReverse(-1.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigPeakOutputReverse(-1.0, 0);
-		Logger::GetLogger()->LogError(prompt, string("ConfigPeakOutputReverse error"));
-		error = ErrorCode::OKAY;
-	}
-
-	SupplyCurrentLimitConfiguration climit;
-	climit.enable = false;
-	climit.currentLimit = 1.0;
-	climit.triggerThresholdCurrent = 1.0;
-	climit.triggerThresholdTime = 0.001;
-	error = m_talon.get()->ConfigSupplyCurrentLimit(climit, 50);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigSupplyCurrentLimit error"));
-		error = ErrorCode::OKAY;
-	}
-
-	error = m_talon.get()->ConfigVoltageCompSaturation(12.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigVoltageCompSaturation error"));
-		error = ErrorCode::OKAY;
-	}
-
-	error = m_talon.get()->ConfigForwardLimitSwitchSource(LimitSwitchSource::LimitSwitchSource_Deactivated, LimitSwitchNormal::LimitSwitchNormal_Disabled, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigForwardLimitSwitchSource error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigReverseLimitSwitchSource(LimitSwitchSource::LimitSwitchSource_Deactivated, LimitSwitchNormal::LimitSwitchNormal_Disabled, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigReverseLimitSwitchSource error"));
-		error = ErrorCode::OKAY;
-	}
-
-	error = m_talon.get()->ConfigForwardSoftLimitEnable(false, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigForwardSoftLimitEnable error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigForwardSoftLimitThreshold(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigForwardSoftLimitThreshold error"));
-		error = ErrorCode::OKAY;
-	}
-
-	error = m_talon.get()->ConfigReverseSoftLimitEnable(false, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigReverseSoftLimitEnable error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigReverseSoftLimitThreshold(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigReverseSoftLimitThreshold error"));
-		error = ErrorCode::OKAY;
-	}
-	
-	
-	error = m_talon.get()->ConfigMotionAcceleration(1500.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigMotionAcceleration error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigMotionCruiseVelocity(1500.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigMotionCruiseVelocity error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigMotionSCurveStrength(0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigMotionSCurveStrength error"));
-		error = ErrorCode::OKAY;
-	}
-
-	error = m_talon.get()->ConfigMotionProfileTrajectoryPeriod(0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigMotionProfileTrajectoryPeriod error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigMotionProfileTrajectoryInterpolationEnable(true, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigMotionProfileTrajectoryInterpolationEnable error"));
-		error = ErrorCode::OKAY;
-	}
 
-	m_talon.get()->ConfigAllowableClosedloopError(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigAllowableClosedloopError error"));
-		error = ErrorCode::OKAY;
-	}
+	TalonSRXConfiguration config;
+	DragonTalonConfig::SetDefaults( config );
+	config.continuousCurrentLimit = 1;
+	config.peakCurrentLimit       = 1;
+	config.peakCurrentDuration    = 1;
+	DragonTalonConfig::Apply( m_talon.get(), config, prompt );
+	m_talon.get()->EnableCurrentLimit( false );
 
-	for ( auto inx=0; inx<4; ++inx )
-	{
-		error = m_talon.get()->ConfigClosedLoopPeakOutput(inx, 1.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogError(prompt, string("ConfigClosedLoopPeakOutput error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->ConfigClosedLoopPeriod(inx, 10, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogError(prompt, string("ConfigClosedLoopPeriod error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kP(inx, 0.01, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogError(prompt, string("Config_kP error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kI(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogError(prompt, string("Config_kI error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kD(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogError(prompt, string("Config_kD error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kF(inx, 1.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogError(prompt, string("Config_kF error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_IntegralZone(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogError(prompt, string("Config_IntegralZone error"));
-			error = ErrorCode::OKAY;
-		}
-	}
+	m_talon.get()->SetNeutralMode(NeutralMode::Brake);
 
-	error = m_talon.get()->ConfigRemoteFeedbackFilter(60, RemoteSensorSource::RemoteSensorSource_Off, 0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigRemoteFeedbackFilter error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigRemoteFeedbackFilter(60, RemoteSensorSource::RemoteSensorSource_Off, 1, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogError(prompt, string("ConfigRemoteFeedbackFilter error"));
-	}
+	DragonTalonConfig::ReportInitTime( prompt, start );
 }
 
 double DragonTalon::GetRotations() const
 {
-	return (ConversionUtils::CountsToRevolutions( (m_talon.get()->GetSelectedSensorPosition()), m_countsPerRev) / m_gearRatio);
+	auto counts = ( m_sensors != nullptr && m_sensors->valid ) ? m_sensors->position : m_talon.get()->GetSelectedSensorPosition();
+	return (ConversionUtils::CountsToRevolutions( counts, m_countsPerRev) / m_gearRatio);
 }
 
 double DragonTalon::GetRPS() const
 {
-	return (ConversionUtils::CountsPer100msToRPS( m_talon.get()->GetSelectedSensorVelocity(), m_countsPerRev) / m_gearRatio);
+	auto counts = ( m_sensors != nullptr && m_sensors->valid ) ? m_sensors->velocity : m_talon.get()->GetSelectedSensorVelocity();
+	return (ConversionUtils::CountsPer100msToRPS( counts, m_countsPerRev) / m_gearRatio);
+}
+
+void DragonTalon::ReadSensors
+(
+	MotorSensorData&	data
+) const
+{
+	auto talon = m_talon.get();
+	data.position    = talon->GetSelectedSensorPosition();
+	data.velocity    = talon->GetSelectedSensorVelocity();
+	data.output      = talon->GetMotorOutputPercent();
+	data.current     = talon->GetSupplyCurrent();
+	data.temperature = talon->GetTemperature();
+	data.valid       = true;
 }
 
 void DragonTalon::SetControlMode(ControlModes::CONTROL_TYPE mode)
 { 
+	if ( mode != m_controlMode )
+	{
+		m_outputCache.Invalidate();
+	}
 	m_controlMode = mode;
 }
 
@@ -296,7 +137,7 @@ shared_ptr<MotorController> DragonTalon::GetSpeedController() const
 
 double DragonTalon::GetCurrent() const
 {
-	return 0.0;
+	return ( m_sensors != nullptr && m_sensors->valid ) ? m_sensors->current : 0.0;
 	//PowerDistributionPanel* pdp = DragonPDP::GetInstance()->GetPDP();
     //return ( pdp != nullptr ) ? pdp->GetCurrent( m_pdp ) : 0.0;
 }
@@ -316,9 +157,10 @@ void DragonTalon::SetFramePeriodPriority
 {
 	switch ( priority )
 	{
+		case ODOMETRY:
 		case HIGH:
 			UpdateFramePeriods( StatusFrameEnhanced::Status_1_General, 10 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, 20 );
+			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, priority == ODOMETRY ? ODOMETRY_FEEDBACK_PERIOD_MS : 20 );
 			UpdateFramePeriods( StatusFrameEnhanced::Status_3_Quadrature, 100 );
 			UpdateFramePeriods( StatusFrameEnhanced::Status_4_AinTempVbat, 150 );
 			UpdateFramePeriods( StatusFrameEnhanced::Status_8_PulseWidth, 120 );
@@ -369,12 +211,29 @@ void DragonTalon::SetFramePeriodPriority
 
 void DragonTalon::Set(std::shared_ptr<nt::NetworkTable> nt, double value)
 {
-	Logger::GetLogger()->ToNtTable(nt, string("motor id"), m_talon.get()->GetDeviceID());
+	SetOutput(nt, value, 0.0);
+}
+
+void DragonTalon::SetOutput
+(
+	std::shared_ptr<nt::NetworkTable>	nt,
+	double								value,
+	double								arbFeedForward
+)
+{
+	if ( nt.get() != nullptr && nt.get()->GetPath() != m_ntPath )
+	{
+		RegisterNtHandles( nt );
+	}
+
+	Logger::GetLogger()->ToNtTable(m_ntMotorIdHandle, m_talon.get()->GetDeviceID());
 
 	if ( m_controlMode == ControlModes::CONTROL_TYPE::VOLTAGE)
 	{
-		Logger::GetLogger()->ToNtTable(nt, string("motor target output voltage"), value);
+		Logger::GetLogger()->ToNtTable(m_ntTargetVoltageHandle, value);
+		// the percent output sent depends on the battery voltage, so always send it
 		m_talon.get()->SetVoltage(units::voltage::volt_t(value));
+		m_outputCache.Invalidate();
 	}
 	else
 	{
@@ -448,22 +307,55 @@ void DragonTalon::Set(std::shared_ptr<nt::NetworkTable> nt, double value)
 				break;
 		}	
 
-		Logger::GetLogger()->ToNtTable(nt, string("motor target output"), output);
+		Logger::GetLogger()->ToNtTable(m_ntTargetOutputHandle, output);
 
-		m_talon.get()->Set( ctreMode, output );
+		if ( m_outputCache.ShouldSend( static_cast<int>(ctreMode), output, arbFeedForward ) )
+		{
+			if ( arbFeedForward == 0.0 )
+			{
+				m_talon.get()->Set( ctreMode, output );
+			}
+			else
+			{
+				m_talon.get()->Set( ctreMode, output, DemandType::DemandType_ArbitraryFeedForward, arbFeedForward );
+			}
+		}
+		Logger::GetLogger()->ToNtTable(m_ntSuppressedHandle, static_cast<double>(m_outputCache.GetSuppressedCount()) );
 
 	}
-	Logger::GetLogger()->ToNtTable(nt, string("motor current percent output"), m_talon.get()->Get() );
-	Logger::GetLogger()->ToNtTable(nt, string("motor current RPS"), GetRPS() );
+	Logger::GetLogger()->ToNtTable(m_ntPercentOutputHandle, m_talon.get()->Get() );
+	Logger::GetLogger()->ToNtTable(m_ntRPSHandle, GetRPS() );
 }
 
 void DragonTalon::Set(double value)
 {
-	auto id = m_talon.get()->GetDeviceID();
-	auto ntName = std::string("MotorOutput");
-	ntName += to_string(id);
-	auto nt = nt::NetworkTableInstance::GetDefault().GetTable(ntName);
-	Set(nt, value);
+	SetWithFeedForward(value, 0.0);
+}
+
+void DragonTalon::SetWithFeedForward(double value, double arbFeedForward)
+{
+	if ( m_motorOutputTable.get() == nullptr )
+	{
+		auto ntName = std::string("MotorOutput");
+		ntName += to_string(m_id);
+		m_motorOutputTable = nt::NetworkTableInstance::GetDefault().GetTable(ntName);
+	}
+	SetOutput(m_motorOutputTable, value, arbFeedForward);
+}
+
+void DragonTalon::RegisterNtHandles
+(
+	std::shared_ptr<nt::NetworkTable> nt
+)
+{
+	auto logger = Logger::GetLogger();
+	m_ntPath = string(nt.get()->GetPath());
+	m_ntMotorIdHandle       = logger->RegisterNtEntry( m_ntPath, string("motor id") );
+	m_ntTargetVoltageHandle = logger->RegisterNtEntry( m_ntPath, string("motor target output voltage") );
+	m_ntTargetOutputHandle  = logger->RegisterNtEntry( m_ntPath, string("motor target output") );
+	m_ntPercentOutputHandle = logger->RegisterNtEntry( m_ntPath, string("motor current percent output") );
+	m_ntRPSHandle           = logger->RegisterNtEntry( m_ntPath, string("motor current RPS") );
+	m_ntSuppressedHandle    = logger->RegisterNtEntry( m_ntPath, string("suppressed writes") );
 }
 void DragonTalon::SetRotationOffset(double rotations)
 {
@@ -631,6 +523,7 @@ void DragonTalon::SetAsFollowerMotor
 )
 {
     m_talon.get()->Set( ControlMode::Follower, masterCANID );
+    m_outputCache.Invalidate();
 }
 
 
@@ -781,4 +674,5 @@ void DragonTalon::SetVoltage
 )
 {
 	m_talon.get()->SetVoltage(output);
+	m_outputCache.Invalidate();
 }
@@ -8,11 +8,13 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <frc/motorcontrol/MotorController.h>
 
 #include <controllers/ControlModes.h>
+#include <hw/DragonOutputCache.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/usages/MotorControllerUsage.h>
 
@@ -51,6 +53,7 @@ class DragonTalon : public IDragonMotorController
         void SetControlMode(ControlModes::CONTROL_TYPE mode) override; //:D
         void Set(double value) override;
         void Set(std::shared_ptr<nt::NetworkTable> nt, double value) override;
+        void SetWithFeedForward(double value, double arbFeedForward) override;
         void SetRotationOffset(double rotations) override;
         void SetVoltageRamping(double ramping, double rampingClosedLoop = -1) override; // seconds 0 to full, set to 0 to disable
         void EnableCurrentLimiting(bool enabled) override; 
@@ -122,8 +125,29 @@ class DragonTalon : public IDragonMotorController
         ) override;
 
         double GetGearRatio() const override { return m_gearRatio;}
+        uint64_t GetSuppressedWrites() const override { return m_outputCache.GetSuppressedCount(); }
+        void ReadSensors( MotorSensorData& data ) const override;
+        void UseSensorSnapshot( const MotorSensorData* data ) override { m_sensors = data; }
 
     private:
+        /// @brief  Convert the value to controller units for the current control mode and send it
+        /// @param [in] std::shared_ptr<nt::NetworkTable> nt - table the motor output is logged to
+        /// @param [in] double value - output in the units of the current control mode
+        /// @param [in] double arbFeedForward - percent output feed forward (0.0 for none)
+        void SetOutput
+        (
+            std::shared_ptr<nt::NetworkTable>   nt,
+            double                              value,
+            double                              arbFeedForward
+        );
+
+        /// @brief  Resolve the network table handles Set() writes to for the given table
+        /// @param [in] std::shared_ptr<nt::NetworkTable> nt - table the motor output is logged to
+        void RegisterNtHandles
+        (
+            std::shared_ptr<nt::NetworkTable> nt
+        );
+
         std::shared_ptr<ctre::phoenix::motorcontrol::can::WPI_TalonSRX>  m_talon;
         ControlModes::CONTROL_TYPE m_controlMode;
         MotorControllerUsage::MOTOR_CONTROLLER_USAGE m_type;
@@ -134,6 +158,18 @@ class DragonTalon : public IDragonMotorController
         int m_tickOffset;
         double m_gearRatio;
         double m_diameter;
+
+        std::shared_ptr<nt::NetworkTable> m_motorOutputTable;   // MotorOutput<id> table used by Set(double)
+        std::string m_ntPath;                                   // table the Set() handles are registered against
+        int m_ntMotorIdHandle;
+        int m_ntTargetVoltageHandle;
+        int m_ntTargetOutputHandle;
+        int m_ntPercentOutputHandle;
+        int m_ntRPSHandle;
+        int m_ntSuppressedHandle;
+
+        DragonOutputCache m_outputCache;                        // last command sent, used to skip repeated writes
+        const MotorSensorData* m_sensors;                       // per loop sample (owned by DragonMotorControllerFactory)
 };
 
 typedef std::vector<DragonTalon*> DragonTalonVector;
\ No newline at end of file
@@ -0,0 +1,318 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// DragonTalonConfig.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Builds the startup configuration shared by DragonTalon and DragonFalcon and retries the 
+///     settings that didn't make it.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/DragonTalonConfig.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+#include <ctre/phoenix/ErrorCode.h>
+#include <ctre/phoenix/motorcontrol/LimitSwitchType.h>
+#include <ctre/phoenix/motorcontrol/RemoteSensorSource.h>
+#include <ctre/phoenix/motorcontrol/can/BaseTalon.h>
+#include <ctre/phoenix/motorcontrol/can/TalonFX.h>
+#include <ctre/phoenix/motorcontrol/can/TalonSRX.h>
+
+using namespace std;
+using namespace ctre::phoenix;
+using namespace ctre::phoenix::motorcontrol;
+using namespace ctre::phoenix::motorcontrol::can;
+
+namespace
+{
+    constexpr int NUM_SLOTS = 4;
+
+    /// the controller stores most settings as fixed point, so allow for rounding when comparing
+    bool Differs
+    (
+        double  desired,
+        double  actual
+    )
+    {
+        return abs( desired - actual ) > 0.001 * max( 1.0, abs( desired ) );
+    }
+
+    const SlotConfiguration& GetSlot
+    (
+        const BaseTalonConfiguration&   config,
+        int                             slot
+    )
+    {
+        switch ( slot )
+        {
+            case 1:
+                return config.slot1;
+            case 2:
+                return config.slot2;
+            case 3:
+                return config.slot3;
+            default:
+                return config.slot0;
+        }
+    }
+
+    SlotConfiguration& GetSlot
+    (
+        BaseTalonConfiguration&         config,
+        int                             slot
+    )
+    {
+        return const_cast<SlotConfiguration&>( GetSlot( static_cast<const BaseTalonConfiguration&>( config ), slot ) );
+    }
+}
+
+/// @brief fill in the settings every Talon starts with
+/// @param [out] BaseTalonConfiguration& config - configuration to update
+void DragonTalonConfig::SetDefaults
+(
+    BaseTalonConfiguration&     config
+)
+{
+    config.neutralDeadband                  = 0.01;
+    config.nominalOutputForward             = 0.0;
+    config.nominalOutputReverse             = 0.0;
+    config.openloopRamp                     = 1.0;
+    config.peakOutputForward                = 1.0;
+    config.peakOutputReverse                = -1.0;
+    config.voltageCompSaturation            = 12.0;
+
+    config.forwardLimitSwitchSource         = LimitSwitchSource::LimitSwitchSource_Deactivated;
+    config.forwardLimitSwitchNormal         = LimitSwitchNormal::LimitSwitchNormal_Disabled;
+    config.reverseLimitSwitchSource         = LimitSwitchSource::LimitSwitchSource_Deactivated;
+    config.reverseLimitSwitchNormal         = LimitSwitchNormal::LimitSwitchNormal_Disabled;
+
+    config.forwardSoftLimitEnable           = false;
+    config.forwardSoftLimitThreshold        = 0.0;
+    config.reverseSoftLimitEnable           = false;
+    config.reverseSoftLimitThreshold        = 0.0;
+
+    config.motionAcceleration               = 1500.0;
+    config.motionCruiseVelocity             = 1500.0;
+    config.motionCurveStrength              = 0;
+    config.motionProfileTrajectoryPeriod    = 0;
+    config.trajectoryInterpolationEnable    = true;
+
+    for ( auto inx=0; inx<NUM_SLOTS; ++inx )
+    {
+        auto& slot = GetSlot( config, inx );
+        slot.allowableClosedloopError       = 0.0;
+        slot.closedLoopPeakOutput           = 1.0;
+        slot.closedLoopPeriod               = 10;
+        slot.kP                             = 0.01;
+        slot.kI                             = 0.0;
+        slot.kD                             = 0.0;
+        slot.kF                             = 1.0;
+        slot.integralZone                   = 0.0;
+    }
+
+    config.remoteFilter0.remoteSensorDeviceID   = 60;
+    config.remoteFilter0.remoteSensorSource     = RemoteSensorSource::RemoteSensorSource_Off;
+    config.remoteFilter1.remoteSensorDeviceID   = 60;
+    config.remoteFilter1.remoteSensorSource     = RemoteSensorSource::RemoteSensorSource_Off;
+}
+
+/// @brief log how long the controller took to set up and write it to the MotorInit network table
+/// @param [in] std::string prompt - controller identifier
+/// @param [in] time_point start - when construction started
+void DragonTalonConfig::ReportInitTime
+(
+    const string&                       prompt,
+    chrono::steady_clock::time_point    start
+)
+{
+    auto ms = chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count();
+    Logger::GetLogger()->LogError( Logger::LOGGER_LEVEL::PRINT, prompt, string("initialized in ") + to_string(ms) + string(" ms") );
+    Logger::GetLogger()->ToNtTable( string("MotorInit"), prompt + string(" (ms)"), ms );
+}
+
+/// @brief resend the settings every Talon has that don't match
+/// @returns bool true if all of the resends succeeded
+bool DragonTalonConfig::RetryDifferences
+(
+    BaseTalon*                          talon,
+    const BaseTalonConfiguration&       desired,
+    const BaseTalonConfiguration&       actual,
+    const string&                       prompt
+)
+{
+    auto ok = true;
+    // only call send (resend the setting) if it differs from what the controller has
+    auto retry = [&ok, &prompt]( bool differs, const function<ErrorCode()>& send, const char* name )
+    {
+        if ( differs && send() != ErrorCode::OKAY )
+        {
+            LogError( prompt, string(name) + string(" error") );
+            ok = false;
+        }
+    };
+
+    retry( Differs( desired.neutralDeadband, actual.neutralDeadband ), 
+                        [&]{ return talon->ConfigNeutralDeadband( desired.neutralDeadband, CONFIG_TIMEOUT_MS ); }, "ConfigNeutralDeadband" );
+    retry( Differs( desired.nominalOutputForward, actual.nominalOutputForward ), 
+                        [&]{ return talon->ConfigNominalOutputForward( desired.nominalOutputForward, CONFIG_TIMEOUT_MS ); }, "ConfigNominalOutputForward" );
+    retry( Differs( desired.nominalOutputReverse, actual.nominalOutputReverse ), 
+                        [&]{ return talon->ConfigNominalOutputReverse( desired.nominalOutputReverse, CONFIG_TIMEOUT_MS ); }, "ConfigNominalOutputReverse" );
+    retry( Differs( desired.openloopRamp, actual.openloopRamp ), 
+                        [&]{ return talon->ConfigOpenloopRamp( desired.openloopRamp, CONFIG_TIMEOUT_MS ); }, "ConfigOpenloopRamp" );
+    retry( Differs( desired.peakOutputForward, actual.peakOutputForward ), 
+                        [&]{ return talon->ConfigPeakOutputForward( desired.peakOutputForward, CONFIG_TIMEOUT_MS ); }, "ConfigPeakOutputForward" );
+    retry( Differs( desired.peakOutputReverse, actual.peakOutputReverse ), 
+                        [&]{ return talon->ConfigPeakOutputReverse( desired.peakOutputReverse, CONFIG_TIMEOUT_MS ); }, "ConfigPeakOutputReverse" );
+    retry( Differs( desired.voltageCompSaturation, actual.voltageCompSaturation ), 
+                        [&]{ return talon->ConfigVoltageCompSaturation( desired.voltageCompSaturation, CONFIG_TIMEOUT_MS ); }, "ConfigVoltageCompSaturation" );
+
+    retry( desired.forwardLimitSwitchSource != actual.forwardLimitSwitchSource || desired.forwardLimitSwitchNormal != actual.forwardLimitSwitchNormal,
+                        [&]{ return talon->ConfigForwardLimitSwitchSource( desired.forwardLimitSwitchSource, desired.forwardLimitSwitchNormal, CONFIG_TIMEOUT_MS ); }, "ConfigForwardLimitSwitchSource" );
+    retry( desired.reverseLimitSwitchSource != actual.reverseLimitSwitchSource || desired.reverseLimitSwitchNormal != actual.reverseLimitSwitchNormal,
+                        [&]{ return talon->ConfigReverseLimitSwitchSource( desired.reverseLimitSwitchSource, desired.reverseLimitSwitchNormal, CONFIG_TIMEOUT_MS ); }, "ConfigReverseLimitSwitchSource" );
+
+    retry( desired.forwardSoftLimitEnable != actual.forwardSoftLimitEnable, 
+                        [&]{ return talon->ConfigForwardSoftLimitEnable( desired.forwardSoftLimitEnable, CONFIG_TIMEOUT_MS ); }, "ConfigForwardSoftLimitEnable" );
+    retry( Differs( desired.forwardSoftLimitThreshold, actual.forwardSoftLimitThreshold ), 
+                        [&]{ return talon->ConfigForwardSoftLimitThreshold( desired.forwardSoftLimitThreshold, CONFIG_TIMEOUT_MS ); }, "ConfigForwardSoftLimitThreshold" );
+    retry( desired.reverseSoftLimitEnable != actual.reverseSoftLimitEnable, 
+                        [&]{ return talon->ConfigReverseSoftLimitEnable( desired.reverseSoftLimitEnable, CONFIG_TIMEOUT_MS ); }, "ConfigReverseSoftLimitEnable" );
+    retry( Differs( desired.reverseSoftLimitThreshold, actual.reverseSoftLimitThreshold ), 
+                        [&]{ return talon->ConfigReverseSoftLimitThreshold( desired.reverseSoftLimitThreshold, CONFIG_TIMEOUT_MS ); }, "ConfigReverseSoftLimitThreshold" );
+
+    retry( Differs( desired.motionAcceleration, actual.motionAcceleration ), 
+                        [&]{ return talon->ConfigMotionAcceleration( desired.motionAcceleration, CONFIG_TIMEOUT_MS ); }, "ConfigMotionAcceleration" );
+    retry( Differs( desired.motionCruiseVelocity, actual.motionCruiseVelocity ), 
+                        [&]{ return talon->ConfigMotionCruiseVelocity( desired.motionCruiseVelocity, CONFIG_TIMEOUT_MS ); }, "ConfigMotionCruiseVelocity" );
+    retry( desired.motionCurveStrength != actual.motionCurveStrength, 
+                        [&]{ return talon->ConfigMotionSCurveStrength( desired.motionCurveStrength, CONFIG_TIMEOUT_MS ); }, "ConfigMotionSCurveStrength" );
+    retry( desired.motionProfileTrajectoryPeriod != actual.motionProfileTrajectoryPeriod, 
+                        [&]{ return talon->ConfigMotionProfileTrajectoryPeriod( desired.motionProfileTrajectoryPeriod, CONFIG_TIMEOUT_MS ); }, "ConfigMotionProfileTrajectoryPeriod" );
+    retry( desired.trajectoryInterpolationEnable != actual.trajectoryInterpolationEnable, 
+                        [&]{ return talon->ConfigMotionProfileTrajectoryInterpolationEnable( desired.trajectoryInterpolationEnable, CONFIG_TIMEOUT_MS ); }, "ConfigMotionProfileTrajectoryInterpolationEnable" );
+
+    for ( auto inx=0; inx<NUM_SLOTS; ++inx )
+    {
+        const auto& want = GetSlot( desired, inx );
+        const auto& have = GetSlot( actual, inx );
+        retry( Differs( want.allowableClosedloopError, have.allowableClosedloopError ), 
+                            [&]{ return talon->ConfigAllowableClosedloopError( inx, want.allowableClosedloopError, CONFIG_TIMEOUT_MS ); }, "ConfigAllowableClosedloopError" );
+        retry( Differs( want.closedLoopPeakOutput, have.closedLoopPeakOutput ), 
+                            [&]{ return talon->ConfigClosedLoopPeakOutput( inx, want.closedLoopPeakOutput, CONFIG_TIMEOUT_MS ); }, "ConfigClosedLoopPeakOutput" );
+        retry( want.closedLoopPeriod != have.closedLoopPeriod, 
+                            [&]{ return talon->ConfigClosedLoopPeriod( inx, want.closedLoopPeriod, CONFIG_TIMEOUT_MS ); }, "ConfigClosedLoopPeriod" );
+        retry( Differs( want.kP, have.kP ), [&]{ return talon->Config_kP( inx, want.kP, CONFIG_TIMEOUT_MS ); }, "Config_kP" );
+        retry( Differs( want.kI, have.kI ), [&]{ return talon->Config_kI( inx, want.kI, CONFIG_TIMEOUT_MS ); }, "Config_kI" );
+        retry( Differs( want.kD, have.kD ), [&]{ return talon->Config_kD( inx, want.kD, CONFIG_TIMEOUT_MS ); }, "Config_kD" );
+        retry( Differs( want.kF, have.kF ), [&]{ return talon->Config_kF( inx, want.kF, CONFIG_TIMEOUT_MS ); }, "Config_kF" );
+        retry( Differs( want.integralZone, have.integralZone ), 
+                            [&]{ return talon->Config_IntegralZone( inx, want.integralZone, CONFIG_TIMEOUT_MS ); }, "Config_IntegralZone" );
+    }
+
+    retry( desired.remoteFilter0.remoteSensorDeviceID != actual.remoteFilter0.remoteSensorDeviceID || desired.remoteFilter0.remoteSensorSource != actual.remoteFilter0.remoteSensorSource,
+                        [&]{ return talon->ConfigRemoteFeedbackFilter( desired.remoteFilter0.remoteSensorDeviceID, desired.remoteFilter0.remoteSensorSource, 0, CONFIG_TIMEOUT_MS ); }, "ConfigRemoteFeedbackFilter" );
+    retry( desired.remoteFilter1.remoteSensorDeviceID != actual.remoteFilter1.remoteSensorDeviceID || desired.remoteFilter1.remoteSensorSource != actual.remoteFilter1.remoteSensorSource,
+                        [&]{ return talon->ConfigRemoteFeedbackFilter( desired.remoteFilter1.remoteSensorDeviceID, desired.remoteFilter1.remoteSensorSource, 1, CONFIG_TIMEOUT_MS ); }, "ConfigRemoteFeedbackFilter" );
+
+    return ok;
+}
+
+/// @brief resend the TalonSRX settings (including current limits) that don't match
+bool DragonTalonConfig::RetryDeviceDifferences
+(
+    TalonSRX*                           talon,
+    const TalonSRXConfiguration&        desired,
+    const TalonSRXConfiguration&        actual,
+    const string&                       prompt
+)
+{
+    auto ok = RetryDifferences( talon, desired, actual, prompt );
+    if ( desired.continuousCurrentLimit != actual.continuousCurrentLimit ||
+         desired.peakCurrentLimit != actual.peakCurrentLimit ||
+         desired.peakCurrentDuration != actual.peakCurrentDuration )
+    {
+        SupplyCurrentLimitConfiguration climit;
+        climit.enable                  = false;
+        climit.currentLimit            = desired.continuousCurrentLimit;
+        climit.triggerThresholdCurrent = desired.peakCurrentLimit;
+        climit.triggerThresholdTime    = desired.peakCurrentDuration / 1000.0;
+        if ( talon->ConfigSupplyCurrentLimit( climit, CONFIG_TIMEOUT_MS ) != ErrorCode::OKAY )
+        {
+            LogError( prompt, string("ConfigSupplyCurrentLimit error") );
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/// @brief resend the TalonFX settings (including current limits) that don't match
+bool DragonTalonConfig::RetryDeviceDifferences
+(
+    TalonFX*                            talon,
+    const TalonFXConfiguration&         desired,
+    const TalonFXConfiguration&         actual,
+    const string&                       prompt
+)
+{
+    auto ok = RetryDifferences( talon, desired, actual, prompt );
+    if ( desired.supplyCurrLimit.enable != actual.supplyCurrLimit.enable ||
+         Differs( desired.supplyCurrLimit.currentLimit, actual.supplyCurrLimit.currentLimit ) ||
+         Differs( desired.supplyCurrLimit.triggerThresholdCurrent, actual.supplyCurrLimit.triggerThresholdCurrent ) ||
+         Differs( desired.supplyCurrLimit.triggerThresholdTime, actual.supplyCurrLimit.triggerThresholdTime ) )
+    {
+        if ( talon->ConfigSupplyCurrentLimit( desired.supplyCurrLimit, CONFIG_TIMEOUT_MS ) != ErrorCode::OKAY )
+        {
+            LogError( prompt, string("ConfigSupplyCurrentLimit error") );
+            ok = false;
+        }
+    }
+    if ( desired.statorCurrLimit.enable != actual.statorCurrLimit.enable ||
+         Differs( desired.statorCurrLimit.currentLimit, actual.statorCurrLimit.currentLimit ) ||
+         Differs( desired.statorCurrLimit.triggerThresholdCurrent, actual.statorCurrLimit.triggerThresholdCurrent ) ||
+         Differs( desired.statorCurrLimit.triggerThresholdTime, actual.statorCurrLimit.triggerThresholdTime ) )
+    {
+        if ( talon->ConfigStatorCurrentLimit( desired.statorCurrLimit, CONFIG_TIMEOUT_MS ) != ErrorCode::OKAY )
+        {
+            LogError( prompt, string("ConfigStatorCurrentLimit error") );
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+void DragonTalonConfig::LogError
+(
+    const string&       prompt,
+    const string&       message
+)
+{
+    Logger::GetLogger()->LogError( prompt, message );
+}
@@ -0,0 +1,137 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// DragonTalonConfig.h
+//========================================================================================================
+///
+/// File Description:
+///     Builds the startup configuration shared by DragonTalon and DragonFalcon and pushes it to the 
+///     controller with a single ConfigAllSettings call.  If that call reports an error, the settings
+///     are read back and only the ones that don't match are sent again.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <chrono>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+#include <ctre/phoenix/ErrorCode.h>
+#include <ctre/phoenix/motorcontrol/can/BaseTalon.h>
+#include <ctre/phoenix/motorcontrol/can/TalonFX.h>
+#include <ctre/phoenix/motorcontrol/can/TalonSRX.h>
+
+
+class DragonTalonConfig
+{
+    public:
+        DragonTalonConfig() = delete;
+        ~DragonTalonConfig() = delete;
+
+        /// @brief fill in the settings every Talon starts with
+        /// @param [out] BaseTalonConfiguration& config - configuration to update
+        static void SetDefaults
+        (
+            ctre::phoenix::motorcontrol::can::BaseTalonConfiguration&   config
+        );
+
+        /// @brief push the whole configuration in one call; on an error read it back and resend 
+        ///        only the settings that differ
+        /// @param [in] TALON* talon - controller to configure (TalonSRX or TalonFX)
+        /// @param [in] CONFIG& config - configuration to apply (TalonSRXConfiguration or TalonFXConfiguration)
+        /// @param [in] std::string prompt - identifier used when logging errors
+        /// @returns bool true if the controller ends up with the configuration
+        template <typename TALON, typename CONFIG>
+        static bool Apply
+        (
+            TALON*                  talon,
+            const CONFIG&           config,
+            const std::string&      prompt
+        )
+        {
+            auto error = talon->ConfigAllSettings( config, CONFIG_TIMEOUT_MS );
+            if ( error == ctre::phoenix::ErrorCode::OKAY )
+            {
+                return true;
+            }
+
+            LogError( prompt, std::string("ConfigAllSettings error, retrying differences") );
+            CONFIG actual;
+            error = talon->GetAllConfigs( actual, CONFIG_TIMEOUT_MS );
+            if ( error != ctre::phoenix::ErrorCode::OKAY )
+            {
+                // can't tell what made it, so send everything again
+                LogError( prompt, std::string("GetAllConfigs error") );
+                return talon->ConfigAllSettings( config, CONFIG_TIMEOUT_MS ) == ctre::phoenix::ErrorCode::OKAY;
+            }
+
+            return RetryDeviceDifferences( talon, config, actual, prompt );
+        }
+
+        /// @brief log how long the controller took to set up and write it to the MotorInit network table
+        /// @param [in] std::string prompt - controller identifier
+        /// @param [in] time_point start - when construction started
+        static void ReportInitTime
+        (
+            const std::string&                          prompt,
+            std::chrono::steady_clock::time_point       start
+        );
+
+        static constexpr int CONFIG_TIMEOUT_MS = 100;
+
+    private:
+        /// @brief resend the settings every Talon has that don't match
+        /// @returns bool true if all of the resends succeeded
+        static bool RetryDifferences
+        (
+            ctre::phoenix::motorcontrol::can::BaseTalon*                        talon,
+            const ctre::phoenix::motorcontrol::can::BaseTalonConfiguration&     desired,
+            const ctre::phoenix::motorcontrol::can::BaseTalonConfiguration&     actual,
+            const std::string&                                                  prompt
+        );
+
+        /// @brief resend the TalonSRX settings (including current limits) that don't match
+        static bool RetryDeviceDifferences
+        (
+            ctre::phoenix::motorcontrol::can::TalonSRX*                         talon,
+            const ctre::phoenix::motorcontrol::can::TalonSRXConfiguration&      desired,
+            const ctre::phoenix::motorcontrol::can::TalonSRXConfiguration&      actual,
+            const std::string&                                                  prompt
+        );
+
+        /// @brief resend the TalonFX settings (including current limits) that don't match
+        static bool RetryDeviceDifferences
+        (
+            ctre::phoenix::motorcontrol::can::TalonFX*                          talon,
+            const ctre::phoenix::motorcontrol::can::TalonFXConfiguration&       desired,
+            const ctre::phoenix::motorcontrol::can::TalonFXConfiguration&       actual,
+            const std::string&                                                  prompt
+        );
+
+        static void LogError
+        (
+            const std::string&      prompt,
+            const std::string&      message
+        );
+};
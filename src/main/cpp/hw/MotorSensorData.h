@@ -0,0 +1,48 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// MotorSensorData.h
+//========================================================================================================
+///
+/// File Description:
+///     Sensor values read from a motor controller once per loop.  DragonMotorControllerFactory keeps 
+///     one of these per CAN ID in a single array and refreshes them all together, so every getter 
+///     called during a loop sees the same sample.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+struct MotorSensorData
+{
+    bool    valid       = false;    ///< true once the slot has been refreshed
+    double  position    = 0.0;      ///< selected sensor position (counts)
+    double  velocity    = 0.0;      ///< selected sensor velocity (counts per 100ms)
+    double  output      = 0.0;      ///< applied output (-1.0 to 1.0)
+    double  current     = 0.0;      ///< supply current (amps)
+    double  temperature = 0.0;      ///< controller temperature (degrees C)
+};
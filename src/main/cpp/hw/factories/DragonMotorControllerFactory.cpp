@@ -133,10 +133,42 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::CreateMotorCont
     if ( !hasError )
     {
         m_canControllers[ canID ] = controller;
+        m_sensorData[ canID ] = MotorSensorData();
+        controller.get()->UseSensorSnapshot( &m_sensorData[ canID ] );
     }
 	return controller;
 }
 
+//=======================================================================================
+// Method:          RefreshSensors
+// Description:     Read the sensors on every motor controller into the per loop sample
+// Returns:         void
+//=======================================================================================
+void DragonMotorControllerFactory::RefreshSensors()
+{
+	for ( auto inx=0; inx<63; ++inx )
+	{
+		if ( m_canControllers[inx].get() != nullptr )
+		{
+			m_canControllers[inx].get()->ReadSensors( m_sensorData[inx] );
+		}
+	}
+}
+
+//=======================================================================================
+// Method:          GetSensorData
+// Description:     Return the last sensor sample for a CAN ID
+// Returns:         const MotorSensorData&	sample
+//=======================================================================================
+const MotorSensorData& DragonMotorControllerFactory::GetSensorData
+(
+	int							canID		/// Motor controller CAN ID
+) const
+{
+	static const MotorSensorData invalid;
+	return ( canID > -1 && canID < 63 ) ? m_sensorData[ canID ] : invalid;
+}
+
 
 
 //=======================================================================================
@@ -35,6 +35,7 @@
 
 
 // Team 302 includes
+#include <hw/MotorSensorData.h>
 #include <hw/interfaces/IDragonMotorController.h>
 
 // Third Party Includes
@@ -95,8 +96,6 @@ class DragonMotorControllerFactory
 			bool											reverseLimitSwitchNormallyOpen
 		);
 
-	private:
-
 		//=======================================================================================
 		/// Method:          GetController
 		/// Description:     return motor controller
@@ -108,6 +107,26 @@ class DragonMotorControllerFactory
 			int													canID		/// Motor Controller CAN ID
 		) const;
 
+		//=======================================================================================
+		/// Method:          RefreshSensors
+		/// Description:     Read the sensors on every motor controller into the per loop sample
+		///					 the controllers' getters return until the next refresh.
+		/// Returns:         void
+		//=======================================================================================
+		void RefreshSensors();
+
+		//=======================================================================================
+		/// Method:          GetSensorData
+		/// Description:     Return the last sensor sample for a CAN ID
+		/// Returns:         const MotorSensorData&	 sample (not valid if there isn't a controller
+		///												 with this CAN ID or it hasn't been refreshed)
+		//=======================================================================================
+		const MotorSensorData& GetSensorData
+		(
+			int													canID		/// Motor Controller CAN ID
+		) const;
+
+	private:
 		void CreateTypeMap();
 
         DragonMotorControllerFactory();
@@ -116,6 +135,7 @@ class DragonMotorControllerFactory
         static DragonMotorControllerFactory*                                    m_instance;
 
 		std::array<std::shared_ptr<IDragonMotorController>,63>				    m_canControllers;
+		std::array<MotorSensorData,63>											m_sensorData;
         std::map<std::string, DragonMotorControllerFactory::MOTOR_TYPE>         m_typeMap;
 
 
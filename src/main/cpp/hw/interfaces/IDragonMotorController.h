@@ -17,6 +17,7 @@
 #pragma once
 
 // C++ Includes
+#include <cstdint>
 #include <map>
 #include <memory>
 
@@ -25,6 +26,7 @@
 #include <networktables/NetworkTable.h>
 
 // Team 302 includes
+#include <hw/MotorSensorData.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <controllers/ControlModes.h>
 #include <controllers/ControlData.h>
@@ -42,11 +44,15 @@ class IDragonMotorController
 
         enum MOTOR_PRIORITY
         {
+            ODOMETRY,   // HIGH, with the feedback frame as fast as the chassis odometry runs
             HIGH,
             MEDIUM,
             LOW
         };
 
+        /// @brief feedback frame period at ODOMETRY priority; the chassis odometry notifiers run at this period
+        static constexpr uint8_t ODOMETRY_FEEDBACK_PERIOD_MS = 5;
+
         // Getters
         /// @brief  Return the number of revolutions the output shaft has spun
         /// @return double number of revolutions
@@ -76,6 +82,11 @@ class IDragonMotorController
         virtual void SetControlMode(ControlModes::CONTROL_TYPE mode) = 0;
         virtual void Set(double value) = 0;
         virtual void Set(std::shared_ptr<nt::NetworkTable> nt, double value) = 0;
+
+        /// @brief  Set the output with an arbitrary feed forward the controller adds to its closed loop output
+        /// @param [in] double value - output in the units of the current control mode
+        /// @param [in] double arbFeedForward - feed forward as percent output (-1.0 to 1.0)
+        virtual void SetWithFeedForward(double value, double arbFeedForward) = 0;
         virtual void SetRotationOffset(double rotations) = 0;
         virtual void SetVoltageRamping(double ramping, double closedLoopRamping = -1) = 0;
         virtual void EnableCurrentLimiting(bool enabled) = 0;
@@ -115,6 +126,19 @@ class IDragonMotorController
         virtual ~IDragonMotorController() = default;
         virtual double GetGearRatio() const = 0;
 
+        /// @brief  Number of Set() calls that were not sent to the controller because they matched the last command
+        /// @return uint64_t suppressed write count
+        virtual uint64_t GetSuppressedWrites() const = 0;
+
+        /// @brief  Read position, velocity, applied output, current and temperature from the controller
+        /// @param [out] MotorSensorData& data - sample to fill in
+        virtual void ReadSensors( MotorSensorData& data ) const = 0;
+
+        /// @brief  Have the getters use a sample that is refreshed once per loop instead of reading the
+        ///         controller on every call.  Until the sample is valid the controller is read directly.
+        /// @param [in] const MotorSensorData* data - sample to use (nullptr reads the controller directly)
+        virtual void UseSensorSnapshot( const MotorSensorData* data ) = 0;
+
 
     protected:
 
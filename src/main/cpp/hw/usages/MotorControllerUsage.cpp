@@ -50,6 +50,18 @@ MotorControllerUsage::MotorControllerUsage()
     m_usageMap["INTAKE"] = MOTOR_CONTROLLER_USAGE::INTAKE;
     m_usageMap["BALLTRANSFER"] = MOTOR_CONTROLLER_USAGE::BALL_TRANSFER;
     m_usageMap["ARM"] = MOTOR_CONTROLLER_USAGE::ARM;
+    m_usageMap["SWERVE_FRONT_LEFT_DRIVE"]  = MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_LEFT_DRIVE;
+    m_usageMap["SWERVE_FRONT_LEFT_TURN"]   = MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_LEFT_TURN;
+    m_usageMap["SWERVE_FRONT_RIGHT_DRIVE"] = MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_RIGHT_DRIVE;
+    m_usageMap["SWERVE_FRONT_RIGHT_TURN"]  = MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_RIGHT_TURN;
+    m_usageMap["SWERVE_BACK_LEFT_DRIVE"]   = MOTOR_CONTROLLER_USAGE::SWERVE_BACK_LEFT_DRIVE;
+    m_usageMap["SWERVE_BACK_LEFT_TURN"]    = MOTOR_CONTROLLER_USAGE::SWERVE_BACK_LEFT_TURN;
+    m_usageMap["SWERVE_BACK_RIGHT_DRIVE"]  = MOTOR_CONTROLLER_USAGE::SWERVE_BACK_RIGHT_DRIVE;
+    m_usageMap["SWERVE_BACK_RIGHT_TURN"]   = MOTOR_CONTROLLER_USAGE::SWERVE_BACK_RIGHT_TURN;
+    m_usageMap["MECANUM_FRONT_LEFT"]       = MOTOR_CONTROLLER_USAGE::MECANUM_FRONT_LEFT;
+    m_usageMap["MECANUM_FRONT_RIGHT"]      = MOTOR_CONTROLLER_USAGE::MECANUM_FRONT_RIGHT;
+    m_usageMap["MECANUM_BACK_LEFT"]        = MOTOR_CONTROLLER_USAGE::MECANUM_BACK_LEFT;
+    m_usageMap["MECANUM_BACK_RIGHT"]       = MOTOR_CONTROLLER_USAGE::MECANUM_BACK_RIGHT;
 }
 
 MotorControllerUsage::~MotorControllerUsage()
@@ -55,6 +55,18 @@ class MotorControllerUsage
             SHOOTER_1,            
             SHOOTER_2,
             ARM,
+            SWERVE_FRONT_LEFT_DRIVE,
+            SWERVE_FRONT_LEFT_TURN,
+            SWERVE_FRONT_RIGHT_DRIVE,
+            SWERVE_FRONT_RIGHT_TURN,
+            SWERVE_BACK_LEFT_DRIVE,
+            SWERVE_BACK_LEFT_TURN,
+            SWERVE_BACK_RIGHT_DRIVE,
+            SWERVE_BACK_RIGHT_TURN,
+            MECANUM_FRONT_LEFT,
+            MECANUM_FRONT_RIGHT,
+            MECANUM_BACK_LEFT,
+            MECANUM_BACK_RIGHT,
             MAX_MOTOR_CONTROLLER_USAGES
         };
 
@@ -45,12 +45,20 @@ Mech1MotorState::Mech1MotorState
     m_control( control ),
     m_target( target ),
     m_positionBased( false ),
-    m_speedBased( false )
+    m_speedBased( false ),
+    m_targetHandle( Logger::INVALID_NT_HANDLE ),
+    m_speedHandle( Logger::INVALID_NT_HANDLE )
 {
     if ( mechanism == nullptr )
     {
         Logger::GetLogger()->LogError( string("Mech1MotorState::Mech1MotorState"), string("no mechanism"));
     }    
+    else
+    {
+        auto ntName = string(mechanism->GetNetworkTableName());
+        m_targetHandle = Logger::GetLogger()->RegisterNtEntry(ntName, string("Target"));
+        m_speedHandle  = Logger::GetLogger()->RegisterNtEntry(ntName, string("Speed"));
+    }
     
     if ( control == nullptr )
     {
@@ -128,9 +136,8 @@ void Mech1MotorState::Run()
     if ( m_mechanism != nullptr && m_control != nullptr )
     {
         m_mechanism->Update();
-        auto ntName = m_mechanism->GetNetworkTableName();
-        Logger::GetLogger()->ToNtTable(string(ntName), string("Target"), GetTarget());
-        Logger::GetLogger()->ToNtTable(string(ntName), string("Speed"), GetRPS());
+        Logger::GetLogger()->ToNtTable(m_targetHandle, GetTarget());
+        Logger::GetLogger()->ToNtTable(m_speedHandle, GetRPS());
     }
 }
 
@@ -51,4 +51,6 @@ class Mech1MotorState : public IState
         double                          m_target;
         bool                            m_positionBased;
         bool                            m_speedBased;
+        int                             m_targetHandle;
+        int                             m_speedHandle;
 };
@@ -49,12 +49,24 @@ Mech2MotorState::Mech2MotorState
     m_primaryTarget( primaryTarget ),
     m_secondaryTarget( secondaryTarget ),
     m_positionBased( false ),
-    m_speedBased( false )
+    m_speedBased( false ),
+    m_primaryTargetHandle( Logger::INVALID_NT_HANDLE ),
+    m_secondaryTargetHandle( Logger::INVALID_NT_HANDLE ),
+    m_primarySpeedHandle( Logger::INVALID_NT_HANDLE ),
+    m_secondarySpeedHandle( Logger::INVALID_NT_HANDLE )
 {
     if ( mechanism == nullptr )
     {
         Logger::GetLogger()->LogError( string("Mech2MotorState::Mech2MotorState"), string("no mechanism"));
     }    
+    else
+    {
+        auto ntName = string(mechanism->GetNetworkTableName());
+        m_primaryTargetHandle   = Logger::GetLogger()->RegisterNtEntry(ntName, string("Primary Target"));
+        m_secondaryTargetHandle = Logger::GetLogger()->RegisterNtEntry(ntName, string("Secondary Target"));
+        m_primarySpeedHandle    = Logger::GetLogger()->RegisterNtEntry(ntName, string("Primary Speed"));
+        m_secondarySpeedHandle  = Logger::GetLogger()->RegisterNtEntry(ntName, string("Secondary Speed"));
+    }
     
     if ( control == nullptr )
     {
@@ -146,11 +158,10 @@ void Mech2MotorState::Run()
     if ( m_mechanism != nullptr )
     {
         m_mechanism->Update();
-        auto ntName = m_mechanism->GetNetworkTableName();
-        Logger::GetLogger()->ToNtTable(string(ntName), string("Primary Target"), GetPrimaryTarget());
-        Logger::GetLogger()->ToNtTable(string(ntName), string("Secondary Target"), GetSecondaryTarget());
-        Logger::GetLogger()->ToNtTable(string(ntName), string("Primary Speed"), GetPrimaryRPS());
-        Logger::GetLogger()->ToNtTable(string(ntName), string("Secondary Speed"), GetSecondaryRPS());
+        Logger::GetLogger()->ToNtTable(m_primaryTargetHandle, GetPrimaryTarget());
+        Logger::GetLogger()->ToNtTable(m_secondaryTargetHandle, GetSecondaryTarget());
+        Logger::GetLogger()->ToNtTable(m_primarySpeedHandle, GetPrimaryRPS());
+        Logger::GetLogger()->ToNtTable(m_secondarySpeedHandle, GetSecondaryRPS());
     }
 }
 
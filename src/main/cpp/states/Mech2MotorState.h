@@ -53,4 +53,8 @@ class Mech2MotorState : public IState
         double                          m_secondaryTarget;
         bool                            m_positionBased;
         bool                            m_speedBased;
+        int                             m_primaryTargetHandle;
+        int                             m_secondaryTargetHandle;
+        int                             m_primarySpeedHandle;
+        int                             m_secondarySpeedHandle;
 };
@@ -0,0 +1,114 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstddef>
+
+// FRC includes
+
+// Team 302 includes
+#include <states/StateStruc.h>
+
+// Third Party Includes
+
+/// @brief compile time state and transition tables for a state manager.  A manager lists its states
+///        (indexed by state id) and its transitions; NextState only checks the transitions out of the
+///        current state.  The guards are plain functions of an INPUTS snapshot (e.g. the controller
+///        buttons), so a table can be checked without a robot.
+template <typename STATE, int NUM_STATES, typename INPUTS>
+class StateMachine
+{
+    public:
+        /// @brief when guard returns true for the inputs, move from the from state to the to state
+        struct Transition
+        {
+            STATE       from;
+            bool        (*guard)( const INPUTS& inputs );
+            STATE       to;
+        };
+
+        using StateTable = std::array<StateStruc, NUM_STATES>;
+
+        template <size_t NUM_TRANSITIONS>
+        using TransitionTable = std::array<Transition, NUM_TRANSITIONS>;
+
+        /// @brief  the state to move to; the first transition out of current whose guard is true wins
+        /// @param [in]     table - transitions
+        /// @param [in]     current - current state
+        /// @param [in]     inputs - what the guards check
+        /// @return STATE - the transition's state or current if no guard is true
+        template <size_t NUM_TRANSITIONS>
+        static constexpr STATE NextState
+        (
+            const TransitionTable<NUM_TRANSITIONS>&     table,
+            STATE                                       current,
+            const INPUTS&                               inputs
+        )
+        {
+            for ( const auto& transition : table )
+            {
+                if ( transition.from == current && transition.guard( inputs ) )
+                {
+                    return transition.to;
+                }
+            }
+            return current;
+        }
+
+        /// @brief  are the states in state id order with one default
+        /// @param [in]     states - state table
+        /// @return bool
+        static constexpr bool IsValid
+        (
+            const StateTable&                           states
+        )
+        {
+            auto defaults = 0;
+            for ( auto inx=0; inx<NUM_STATES; ++inx )
+            {
+                if ( states[inx].id != inx )
+                {
+                    return false;
+                }
+                defaults += states[inx].isDefault ? 1 : 0;
+            }
+            return defaults == 1;
+        }
+
+        /// @brief  do the transitions only use states in the table, and never go nowhere
+        /// @param [in]     table - transitions
+        /// @return bool
+        template <size_t NUM_TRANSITIONS>
+        static constexpr bool IsValid
+        (
+            const TransitionTable<NUM_TRANSITIONS>&     table
+        )
+        {
+            for ( const auto& transition : table )
+            {
+                if ( transition.from < 0 || transition.from >= NUM_STATES ||
+                     transition.to < 0   || transition.to >= NUM_STATES   ||
+                     transition.from == transition.to || transition.guard == nullptr )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+};
@@ -14,17 +14,20 @@
 //====================================================================================================================================================
 
 // C++ Includes
-#include <map>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <vector>
 
 // FRC includes
+#include <frc/Timer.h>
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
 
 // Team 302 includes
 #include <controllers/MechanismTargetData.h>
+#include <gamepad/TeleopControl.h>
 #include <states/arm/ArmState.h>
 #include <states/intake/IntakeState.h>
 #include <states/ballrelease/BallReleaseState.h>
@@ -46,38 +49,46 @@ using namespace std;
 /// @brief    initialize the state manager, parse the configuration file and create the states.
 StateMgr::StateMgr() : m_mech(nullptr),
                        m_currentState(),
-                       m_stateVector(),
-                       m_currentStateID(0)
+                       m_states(),
+                       m_numStates(0),
+                       m_currentStateID(0),
+                       m_subscriptions(),
+                       m_simulated(false),
+                       m_simTimeToTarget(),
+                       m_simTargetTime(0)
 {
 }
 void StateMgr::Init
 (
     IMech*                                  mech,
-    const map<string,StateStruc>&           stateMap
+    const StateStruc*                       states,
+    int                                     numStates
 ) 
 {
     m_mech = mech;
+    m_numStates = numStates;
+    if ( mech == nullptr )
+    {
+        return;     // mechanism isn't on this robot, so there are no states to create
+    }
     
     // Parse the configuration file 
     auto stateXML = make_unique<StateDataDefn>();
     vector<MechanismTargetData*> targetData = stateXML.get()->ParseXML(mech->GetType());
 
-    // initialize the xml string to state map
-    m_stateVector.resize(stateMap.size());
     // create the states passing the configuration data
     for ( auto td: targetData )
     {
         auto stateString = td->GetStateString();
-        auto stateStringToStrucItr = stateMap.find( stateString );
-        if ( stateStringToStrucItr != stateMap.end() )
+        auto struc = find_if( states, states + numStates, [&stateString]( const StateStruc& state ) { return strcmp( state.xmlString, stateString.c_str() ) == 0; } );
+        if ( struc != states + numStates )
         {
-            auto struc = stateStringToStrucItr->second;
-            auto slot = struc.id;
-            if ( m_stateVector[slot] == nullptr )
+            auto slot = struc->id;
+            if ( m_states[slot] == nullptr )
             {
                 auto controlData = td->GetController();
                 auto target = td->GetTarget();
-                auto type = struc.type;
+                auto type = struc->type;
                 IState* thisState = nullptr;
                 switch (type)
                 {
@@ -101,8 +112,8 @@ void StateMgr::Init
                 }
                 if (thisState != nullptr)
                 {
-                    m_stateVector[slot] = thisState;
-                    if (struc.isDefault)
+                    m_states[slot] = thisState;
+                    if (struc->isDefault)
                     {
                         m_currentState = thisState;
                         m_currentStateID = slot;
@@ -128,7 +139,10 @@ void StateMgr::RunCurrentState()
 {
     if ( m_mech != nullptr )
     {
-        CheckForStateTransition();
+        if ( m_subscriptions.none() || HasInputEvent() )
+        {
+            CheckForStateTransition();
+        }
 
         // run the current state
         if ( m_currentState != nullptr )
@@ -150,6 +164,34 @@ void StateMgr::CheckForStateTransition()
     //    }
 }
 
+/// @brief  check for transitions only when TeleopControl has an event for the function
+/// @return void
+void StateMgr::SubscribeTo
+(
+    TeleopControl::FUNCTION_IDENTIFIER  function
+)
+{
+    if ( m_mech != nullptr )    // call after Init; no mechanism means nothing to transition
+    {
+        m_subscriptions.set( function );
+        TeleopControl::GetInstance()->Subscribe( function );
+    }
+}
+
+/// @brief  did this loop's TeleopControl::Update report an event this manager subscribed to
+/// @return bool
+bool StateMgr::HasInputEvent() const
+{
+    for ( auto& event : TeleopControl::GetInstance()->GetInputEvents() )
+    {
+        if ( m_subscriptions.test( event.function ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 /// @brief  set the current state, initialize it and run it
 /// @return void
 void StateMgr::SetCurrentState
@@ -158,9 +200,17 @@ void StateMgr::SetCurrentState
     bool            run
 )
 {
-    if (m_mech != nullptr )
+    if ( m_mech == nullptr )
+    {
+        if ( m_simulated && stateID >= 0 && stateID < m_numStates && stateID != m_currentStateID )
+        {
+            m_currentStateID = stateID;
+            m_simTargetTime = frc::Timer::GetFPGATimestamp() + m_simTimeToTarget[stateID];
+        }
+    }
+    else if ( stateID >= 0 && stateID < m_numStates )
     {
-        auto state = m_stateVector[stateID];
+        auto state = m_states[stateID];
         if ( state != nullptr && state != m_currentState)
         {    
             m_currentState = state;
@@ -176,6 +226,50 @@ void StateMgr::SetCurrentState
     }
 }
 
+/// @brief  has the current state reached its target
+/// @return bool - true when there is no mechanism or state to wait on
+bool StateMgr::AtTarget() const
+{
+    if ( m_mech == nullptr )
+    {
+        return !m_simulated || frc::Timer::GetFPGATimestamp() >= m_simTargetTime;
+    }
+    if ( m_currentState == nullptr )
+    {
+        return true;
+    }
+    return m_currentState->AtTarget();
+}
 
+/// @brief  can SetCurrentState switch to this state
+/// @return bool - false if the mechanism exists but the state wasn't created
+bool StateMgr::IsValidState
+(
+    int             stateID
+) const
+{
+    if ( m_mech == nullptr )
+    {
+        return true;
+    }
+    return stateID >= 0 && stateID < m_numStates && m_states[stateID] != nullptr;
+}
 
-
+/// @brief  model a mechanism that isn't on this robot
+/// @return void
+void StateMgr::SimulateMechanism
+(
+    const array<units::second_t, MAX_STATES>&   timeToTarget
+)
+{
+    if ( m_mech == nullptr )
+    {
+        m_simulated = true;
+        m_simTimeToTarget = timeToTarget;
+        m_simTargetTime = frc::Timer::GetFPGATimestamp();
+    }
+    else
+    {
+        Logger::GetLogger()->LogError( string("StateMgr::SimulateMechanism"), string("mechanism exists"));
+    }
+}
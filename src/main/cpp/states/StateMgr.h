@@ -17,30 +17,44 @@
 #pragma once
 
 // C++ Includes
-#include <map>
-#include <vector>
+#include <array>
+#include <bitset>
 
 // FRC includes
 
 // Team 302 includes
+#include <gamepad/TeleopControl.h>
 #include <states/IState.h>
 #include <states/StateStruc.h>
 #include <subsys/interfaces/IMech.h>
 
 
 // Third Party Includes
+#include <units/time.h>
 
 class StateMgr 
 {
     public:
 
+        /// @brief most states a mechanism can have
+        static constexpr int MAX_STATES = 8;
+
         StateMgr();
         ~StateMgr() = default;
+
+        /// @brief  create the mechanism's states from its state xml
+        /// @param [in]     mech - mechanism (nullptr if it isn't on this robot)
+        /// @param [in]     states - state table indexed by state id (see StateMachine)
+        template <size_t NUM_STATES>
         void Init
         (
             IMech*                                      mech,
-            const std::map<std::string,StateStruc>&     stateMap
-        );
+            const std::array<StateStruc, NUM_STATES>&   states
+        )
+        {
+            static_assert( NUM_STATES <= MAX_STATES, "too many states for StateMgr" );
+            Init( mech, states.data(), NUM_STATES );
+        }
 
         /// @brief  run the current state
         /// @return void
@@ -60,15 +74,57 @@ class StateMgr
         /// @return int - the current state
         inline int GetCurrentState() const { return m_currentStateID; };
 
+        /// @brief  has the current state reached its target (true when there is no mechanism or state,
+        ///         or for a simulated mechanism once the state's time to target has passed)
+        /// @return bool
+        bool AtTarget() const;
+
+        /// @brief  can SetCurrentState switch to this state (a manager without a mechanism ignores every state)
+        /// @param [in]     int - state to check
+        /// @return bool - false if the mechanism exists but the state wasn't created
+        bool IsValidState
+        (
+            int         stateID
+        ) const;
+
+        /// @brief  model a mechanism that isn't on this robot (the auton simulator): SetCurrentState still
+        ///         tracks the state and AtTarget is false until the new state's time to target has passed
+        /// @param [in]     timeToTarget - time to reach each state, indexed by state id
+        void SimulateMechanism
+        (
+            const std::array<units::second_t, MAX_STATES>&  timeToTarget
+        );
+
     protected:
         virtual void CheckForStateTransition();
 
+        /// @brief  only check for transitions in loops where TeleopControl reports an event for the
+        ///         function; a manager that doesn't subscribe to anything checks every loop
+        /// @param [in]     function - controller function the transitions depend on
+        void SubscribeTo
+        (
+            TeleopControl::FUNCTION_IDENTIFIER          function
+        );
+
     private:
+        void Init
+        (
+            IMech*                                      mech,
+            const StateStruc*                           states,
+            int                                         numStates
+        );
 
-        IMech*                  m_mech;
-        IState*                 m_currentState;
-        std::vector<IState*>    m_stateVector;
-        int                     m_currentStateID;
+        bool HasInputEvent() const;
+
+        IMech*                              m_mech;
+        IState*                             m_currentState;
+        std::array<IState*, MAX_STATES>     m_states;           // indexed by state id
+        int                                 m_numStates;
+        int                                 m_currentStateID;
+        std::bitset<TeleopControl::FUNCTION_IDENTIFIER::MAX_FUNCTIONS> m_subscriptions;
+        bool                                m_simulated;        // SimulateMechanism was called
+        std::array<units::second_t, MAX_STATES> m_simTimeToTarget;  // indexed by state id
+        units::second_t                     m_simTargetTime;    // when the simulated state is reached
 
 };
 
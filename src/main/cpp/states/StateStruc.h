@@ -10,8 +10,10 @@ enum StateType
 };
 
 
+/// @brief a mechanism state; a manager's table of these is indexed by state id
 struct StateStruc
 {
+    const char* xmlString;      // state name in the mechanism's state xml
     int         id;
     StateType   type;
     bool        isDefault;
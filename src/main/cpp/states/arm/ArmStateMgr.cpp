@@ -14,7 +14,6 @@
 //====================================================================================================================================================
 
 // C++ Includes
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -42,6 +41,42 @@
 
 using namespace std;
 
+namespace
+{
+    constexpr ArmStateMgr::ARM_STATE_MACHINE::StateTable ARM_STATES =
+    {{
+        { "ARMUP",           ArmStateMgr::ARM_STATE::GOING_UP,      StateType::ARM, false },
+        { "ARMDOWN",         ArmStateMgr::ARM_STATE::GOING_DOWN,    StateType::ARM, false },
+        { "ARMHOLDUP",       ArmStateMgr::ARM_STATE::UP_POS,        StateType::ARM, false },
+        { "ARMHOLDDOWN",     ArmStateMgr::ARM_STATE::DOWN_POS,      StateType::ARM, false },
+        { "ARMHOLDPOSITION", ArmStateMgr::ARM_STATE::HOLD_POSITION, StateType::ARM, true  }
+    }};
+    static_assert( ArmStateMgr::ARM_STATE_MACHINE::IsValid( ARM_STATES ), "arm states must be in state id order" );
+
+    constexpr bool UpPressed( const TeleopControl::ButtonStates& buttons ) { return buttons[TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_UP]; }
+    constexpr bool DownPressed( const TeleopControl::ButtonStates& buttons ) { return buttons[TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_DOWN]; }
+    constexpr bool OnlyDownPressed( const TeleopControl::ButtonStates& buttons ) { return !UpPressed( buttons ) && DownPressed( buttons ); }
+    constexpr bool NothingPressed( const TeleopControl::ButtonStates& buttons ) { return !UpPressed( buttons ) && !DownPressed( buttons ); }
+
+    // the arm moves while a button is held (up wins over down) and holds its position otherwise
+    constexpr ArmStateMgr::ARM_STATE_MACHINE::TransitionTable<12> ARM_TRANSITIONS =
+    {{
+        { ArmStateMgr::ARM_STATE::GOING_UP,      OnlyDownPressed, ArmStateMgr::ARM_STATE::GOING_DOWN    },
+        { ArmStateMgr::ARM_STATE::GOING_UP,      NothingPressed,  ArmStateMgr::ARM_STATE::HOLD_POSITION },
+        { ArmStateMgr::ARM_STATE::GOING_DOWN,    UpPressed,       ArmStateMgr::ARM_STATE::GOING_UP      },
+        { ArmStateMgr::ARM_STATE::GOING_DOWN,    NothingPressed,  ArmStateMgr::ARM_STATE::HOLD_POSITION },
+        { ArmStateMgr::ARM_STATE::UP_POS,        UpPressed,       ArmStateMgr::ARM_STATE::GOING_UP      },
+        { ArmStateMgr::ARM_STATE::UP_POS,        DownPressed,     ArmStateMgr::ARM_STATE::GOING_DOWN    },
+        { ArmStateMgr::ARM_STATE::UP_POS,        NothingPressed,  ArmStateMgr::ARM_STATE::HOLD_POSITION },
+        { ArmStateMgr::ARM_STATE::DOWN_POS,      UpPressed,       ArmStateMgr::ARM_STATE::GOING_UP      },
+        { ArmStateMgr::ARM_STATE::DOWN_POS,      DownPressed,     ArmStateMgr::ARM_STATE::GOING_DOWN    },
+        { ArmStateMgr::ARM_STATE::DOWN_POS,      NothingPressed,  ArmStateMgr::ARM_STATE::HOLD_POSITION },
+        { ArmStateMgr::ARM_STATE::HOLD_POSITION, UpPressed,       ArmStateMgr::ARM_STATE::GOING_UP      },
+        { ArmStateMgr::ARM_STATE::HOLD_POSITION, DownPressed,     ArmStateMgr::ARM_STATE::GOING_DOWN    }
+    }};
+    static_assert( ArmStateMgr::ARM_STATE_MACHINE::IsValid( ARM_TRANSITIONS ), "invalid arm transition" );
+}
+
 
 ArmStateMgr* ArmStateMgr::m_instance = nullptr;
 ArmStateMgr* ArmStateMgr::GetInstance()
@@ -57,46 +92,16 @@ ArmStateMgr* ArmStateMgr::GetInstance()
 /// @brief    initialize the state manager, parse the configuration file and create the states.
 ArmStateMgr::ArmStateMgr() 
 {
-    map<string, StateStruc> stateMap;
-    stateMap["ARMUP"] = m_goingUpState;
-    stateMap["ARMDOWN"] = m_goingDownState;
-    stateMap["ARMHOLDUP"] = m_upPosState;
-    stateMap["ARMHOLDDOWN"] = m_downPosState;
-    stateMap["ARMHOLDPOSITION"] = m_holdState;
-    Init(MechanismFactory::GetMechanismFactory()->GetArm(), stateMap);
+    Init(MechanismFactory::GetMechanismFactory()->GetArm(), ARM_STATES);
+    SubscribeTo(TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_UP);
+    SubscribeTo(TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_DOWN);
 }
 
-/// @brief  run the current state
+/// @brief  move to the state the transition table picks
 /// @return void
 void ArmStateMgr::CheckForStateTransition()
 {
-    if ( MechanismFactory::GetMechanismFactory()->GetArm() != nullptr )
-    {
-        // process teleop/manual interrupts
-        auto currentState = static_cast<ARM_STATE>(GetCurrentState());
-        
-        auto controller = TeleopControl::GetInstance();
-        if ( controller != nullptr )
-        {
-            //auto upPressed = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_UP);
-            //auto downPressed = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_DOWN);
-            if (controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_UP)  /*&&  currentState != ARM_STATE::GOING_UP*/ )
-            {
-                SetCurrentState( ARM_STATE::GOING_UP, false );
-            }
-            else if (controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_DOWN)  /*&&  currentState != ARM_STATE::GOING_DOWN*/ )
-            {
-                SetCurrentState( ARM_STATE::GOING_DOWN, false );
-            }
-            else
-            {
-                SetCurrentState(ARM_STATE::HOLD_POSITION, false);
-            }
-            // else if (controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ROTATE_ARM_DOWN))
-            // {
-            //     SetCurrentState(ARM_STATE::HOLD_POSITION, false);
-            // }
-        }
-    }
+    // process teleop/manual interrupts
+    auto currentState = static_cast<ARM_STATE>(GetCurrentState());
+    SetCurrentState( ARM_STATE_MACHINE::NextState( ARM_TRANSITIONS, currentState, TeleopControl::GetInstance()->GetButtonStates() ), false );
 }
-
@@ -21,6 +21,7 @@
 // FRC includes
 
 // Team 302 includes
+#include <states/StateMachine.h>
 #include <states/StateMgr.h>
 #include <states/StateStruc.h>
 
@@ -41,6 +42,8 @@ class ArmStateMgr : public StateMgr
             HOLD_POSITION,
             MAX_ARM_STATES
         };
+
+        using ARM_STATE_MACHINE = StateMachine<ARM_STATE, MAX_ARM_STATES, TeleopControl::ButtonStates>;
         
 		/// @brief  Find or create the state manmanager
 		/// @return ArmStateMgr* pointer to the state manager
@@ -53,12 +56,6 @@ class ArmStateMgr : public StateMgr
         ~ArmStateMgr() = default;
 
 		static ArmStateMgr*	m_instance;
-
-        const StateStruc  m_goingUpState = {ARM_STATE::GOING_UP, StateType::ARM, false};
-        const StateStruc  m_goingDownState = {ARM_STATE::GOING_DOWN, StateType::ARM, false};
-        const StateStruc  m_upPosState = {ARM_STATE::UP_POS, StateType::ARM, false};
-        const StateStruc  m_downPosState = {ARM_STATE::DOWN_POS, StateType::ARM, false};
-        const StateStruc  m_holdState = {ARM_STATE::HOLD_POSITION, StateType::ARM, true};
 };
 
 
@@ -14,7 +14,6 @@
 //====================================================================================================================================================
 
 // C++ Includes
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -41,6 +40,27 @@
 
 using namespace std;
 
+namespace
+{
+    constexpr BallReleaseStateMgr::BALL_RELEASE_STATE_MACHINE::StateTable BALL_RELEASE_STATES =
+    {{
+        { "BALLRELEASEHOLD", BallReleaseStateMgr::BALL_RELEASE_STATE::HOLD,    StateType::BALLRELEASE, true  },
+        { "BALLRELEASEOPEN", BallReleaseStateMgr::BALL_RELEASE_STATE::RELEASE, StateType::BALLRELEASE, false }
+    }};
+    static_assert( BallReleaseStateMgr::BALL_RELEASE_STATE_MACHINE::IsValid( BALL_RELEASE_STATES ), "ball release states must be in state id order" );
+
+    constexpr bool ReleasePressed( const TeleopControl::ButtonStates& buttons ) { return buttons[TeleopControl::FUNCTION_IDENTIFIER::RELEASE]; }
+    constexpr bool ReleaseNotPressed( const TeleopControl::ButtonStates& buttons ) { return !ReleasePressed( buttons ); }
+
+    // release while the button is held
+    constexpr BallReleaseStateMgr::BALL_RELEASE_STATE_MACHINE::TransitionTable<2> BALL_RELEASE_TRANSITIONS =
+    {{
+        { BallReleaseStateMgr::BALL_RELEASE_STATE::HOLD,    ReleasePressed,    BallReleaseStateMgr::BALL_RELEASE_STATE::RELEASE },
+        { BallReleaseStateMgr::BALL_RELEASE_STATE::RELEASE, ReleaseNotPressed, BallReleaseStateMgr::BALL_RELEASE_STATE::HOLD    }
+    }};
+    static_assert( BallReleaseStateMgr::BALL_RELEASE_STATE_MACHINE::IsValid( BALL_RELEASE_TRANSITIONS ), "invalid ball release transition" );
+}
+
 
 BallReleaseStateMgr* BallReleaseStateMgr::m_instance = nullptr;
 BallReleaseStateMgr* BallReleaseStateMgr::GetInstance()
@@ -56,39 +76,15 @@ BallReleaseStateMgr* BallReleaseStateMgr::GetInstance()
 /// @brief    initialize the state manager, parse the configuration file and create the states.
 BallReleaseStateMgr::BallReleaseStateMgr() 
 {
-    map<string, StateStruc> stateMap;
-    stateMap["BALLRELEASEHOLD"] = m_holdState;
-    stateMap["BALLRELEASEOPEN"] = m_releaseState;
-
-    Init(MechanismFactory::GetMechanismFactory()->GetBallRelease(), stateMap);
+    Init(MechanismFactory::GetMechanismFactory()->GetBallRelease(), BALL_RELEASE_STATES);
+    SubscribeTo(TeleopControl::FUNCTION_IDENTIFIER::RELEASE);
 }
 
-/// @brief  run the current state
+/// @brief  move to the state the transition table picks
 /// @return void
 void BallReleaseStateMgr::CheckForStateTransition()
 {
-    if ( MechanismFactory::GetMechanismFactory()->GetBallRelease() != nullptr )
-    {
-        // process teleop/manual interrupts
-        auto currentState = static_cast<BALL_RELEASE_STATE>(GetCurrentState());
-        
-        auto controller = TeleopControl::GetInstance();
-        if ( controller != nullptr )
-        {
-            auto releasePressed = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::RELEASE);
-            if (releasePressed  &&  currentState != BALL_RELEASE_STATE::RELEASE )
-            {
-                SetCurrentState( BALL_RELEASE_STATE::RELEASE, false );
-            }
-            else if (!releasePressed && currentState != BALL_RELEASE_STATE::HOLD)
-            {
-                SetCurrentState(BALL_RELEASE_STATE::HOLD, false);
-            }
-        }
-    }
+    // process teleop/manual interrupts
+    auto currentState = static_cast<BALL_RELEASE_STATE>(GetCurrentState());
+    SetCurrentState( BALL_RELEASE_STATE_MACHINE::NextState( BALL_RELEASE_TRANSITIONS, currentState, TeleopControl::GetInstance()->GetButtonStates() ), false );
 }
-
-
-
-
-
@@ -21,6 +21,7 @@
 // FRC includes
 
 // Team 302 includes
+#include <states/StateMachine.h>
 #include <states/StateMgr.h>
 #include <states/StateStruc.h>
 
@@ -38,6 +39,7 @@ class BallReleaseStateMgr : public StateMgr
             MAX_BALL_RELEASE_STATES
         };
 
+        using BALL_RELEASE_STATE_MACHINE = StateMachine<BALL_RELEASE_STATE, MAX_BALL_RELEASE_STATES, TeleopControl::ButtonStates>;
         
 		/// @brief  Find or create the state manmanager
 		/// @return BallReleaseStateMgr* pointer to the state manager
@@ -50,9 +52,6 @@ class BallReleaseStateMgr : public StateMgr
         ~BallReleaseStateMgr() = default;
 
 		static BallReleaseStateMgr*	m_instance;
-
-        const StateStruc  m_holdState = {BALL_RELEASE_STATE::HOLD, StateType::BALLRELEASE, true};
-        const StateStruc  m_releaseState = {BALL_RELEASE_STATE::RELEASE, StateType::BALLRELEASE, false};
 };
 
 
@@ -14,7 +14,6 @@
 //====================================================================================================================================================
 
 // C++ Includes
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -41,6 +40,34 @@
 
 using namespace std;
 
+namespace
+{
+    constexpr BallTransferStateMgr::BALL_TRANSFER_STATE_MACHINE::StateTable BALL_TRANSFER_STATES =
+    {{
+        { "BALLTRANSFEROFF",    BallTransferStateMgr::BALL_TRANSFER_STATE::OFF,    StateType::BALLTRANSER, true  },
+        { "BALLTRANSFERINTAKE", BallTransferStateMgr::BALL_TRANSFER_STATE::INTAKE, StateType::BALLTRANSER, false },
+        { "BALLTRANSFEREXPEL",  BallTransferStateMgr::BALL_TRANSFER_STATE::EXPEL,  StateType::BALLTRANSER, false }
+    }};
+    static_assert( BallTransferStateMgr::BALL_TRANSFER_STATE_MACHINE::IsValid( BALL_TRANSFER_STATES ), "ball transfer states must be in state id order" );
+
+    constexpr bool IntakePressed( const TeleopControl::ButtonStates& buttons ) { return buttons[TeleopControl::FUNCTION_IDENTIFIER::INTAKE]; }
+    constexpr bool ExpelPressed( const TeleopControl::ButtonStates& buttons ) { return buttons[TeleopControl::FUNCTION_IDENTIFIER::EXPEL]; }
+    constexpr bool OnlyExpelPressed( const TeleopControl::ButtonStates& buttons ) { return !IntakePressed( buttons ) && ExpelPressed( buttons ); }
+    constexpr bool NothingPressed( const TeleopControl::ButtonStates& buttons ) { return !IntakePressed( buttons ) && !ExpelPressed( buttons ); }
+
+    // the transfer follows the intake buttons: intake wins over expel; letting go of both turns it off
+    constexpr BallTransferStateMgr::BALL_TRANSFER_STATE_MACHINE::TransitionTable<6> BALL_TRANSFER_TRANSITIONS =
+    {{
+        { BallTransferStateMgr::BALL_TRANSFER_STATE::OFF,    IntakePressed,    BallTransferStateMgr::BALL_TRANSFER_STATE::INTAKE },
+        { BallTransferStateMgr::BALL_TRANSFER_STATE::OFF,    ExpelPressed,     BallTransferStateMgr::BALL_TRANSFER_STATE::EXPEL  },
+        { BallTransferStateMgr::BALL_TRANSFER_STATE::INTAKE, OnlyExpelPressed, BallTransferStateMgr::BALL_TRANSFER_STATE::EXPEL  },
+        { BallTransferStateMgr::BALL_TRANSFER_STATE::INTAKE, NothingPressed,   BallTransferStateMgr::BALL_TRANSFER_STATE::OFF    },
+        { BallTransferStateMgr::BALL_TRANSFER_STATE::EXPEL,  IntakePressed,    BallTransferStateMgr::BALL_TRANSFER_STATE::INTAKE },
+        { BallTransferStateMgr::BALL_TRANSFER_STATE::EXPEL,  NothingPressed,   BallTransferStateMgr::BALL_TRANSFER_STATE::OFF    }
+    }};
+    static_assert( BallTransferStateMgr::BALL_TRANSFER_STATE_MACHINE::IsValid( BALL_TRANSFER_TRANSITIONS ), "invalid ball transfer transition" );
+}
+
 
 BallTransferStateMgr* BallTransferStateMgr::m_instance = nullptr;
 BallTransferStateMgr* BallTransferStateMgr::GetInstance()
@@ -56,45 +83,16 @@ BallTransferStateMgr* BallTransferStateMgr::GetInstance()
 /// @brief    initialize the state manager, parse the configuration file and create the states.
 BallTransferStateMgr::BallTransferStateMgr() 
 {
-    map<string, StateStruc> stateMap;
-    stateMap["BALLTRANSFEROFF"] = m_offState;
-    stateMap["BALLTRANSFERINTAKE"] = m_intakeState;
-    stateMap["BALLTRANSFEREXPEL"] = m_expelState;
-
-    Init(MechanismFactory::GetMechanismFactory()->GetBallTransfer(), stateMap);
+    Init(MechanismFactory::GetMechanismFactory()->GetBallTransfer(), BALL_TRANSFER_STATES);
+    SubscribeTo(TeleopControl::FUNCTION_IDENTIFIER::INTAKE);
+    SubscribeTo(TeleopControl::FUNCTION_IDENTIFIER::EXPEL);
 }
 
-/// @brief  run the current state
+/// @brief  move to the state the transition table picks
 /// @return void
 void BallTransferStateMgr::CheckForStateTransition()
 {
-    if ( MechanismFactory::GetMechanismFactory()->GetBallTransfer() != nullptr )
-    {
-        // process teleop/manual interrupts
-        auto currentState = static_cast<BALL_TRANSFER_STATE>(GetCurrentState());
-        
-        auto controller = TeleopControl::GetInstance();
-        if ( controller != nullptr )
-        {
-            auto intakePressed = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::INTAKE);
-            auto expelPressed = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::EXPEL);
-            if (intakePressed  &&  currentState != BALL_TRANSFER_STATE::INTAKE )
-            {
-                SetCurrentState( BALL_TRANSFER_STATE::INTAKE, false );
-            }
-            else if (expelPressed && currentState != BALL_TRANSFER_STATE::EXPEL )
-            {
-                SetCurrentState( BALL_TRANSFER_STATE::EXPEL, false );
-            }           
-            else if ((!intakePressed && !expelPressed) && currentState != BALL_TRANSFER_STATE::OFF )
-            {
-                SetCurrentState( BALL_TRANSFER_STATE::OFF, false );
-            }
-        }
-    }
+    // process teleop/manual interrupts
+    auto currentState = static_cast<BALL_TRANSFER_STATE>(GetCurrentState());
+    SetCurrentState( BALL_TRANSFER_STATE_MACHINE::NextState( BALL_TRANSFER_TRANSITIONS, currentState, TeleopControl::GetInstance()->GetButtonStates() ), false );
 }
-
-
-
-
-
@@ -21,6 +21,7 @@
 // FRC includes
 
 // Team 302 includes
+#include <states/StateMachine.h>
 #include <states/StateMgr.h>
 #include <states/StateStruc.h>
 
@@ -39,6 +40,7 @@ class BallTransferStateMgr : public StateMgr
             MAX_BALL_TRANSFER_STATES
         };
 
+        using BALL_TRANSFER_STATE_MACHINE = StateMachine<BALL_TRANSFER_STATE, MAX_BALL_TRANSFER_STATES, TeleopControl::ButtonStates>;
         
 		/// @brief  Find or create the state manmanager
 		/// @return BallTransferStateMgr* pointer to the state manager
@@ -51,10 +53,6 @@ class BallTransferStateMgr : public StateMgr
         ~BallTransferStateMgr() = default;
 
 		static BallTransferStateMgr*	m_instance;
-
-        const StateStruc  m_offState = {BALL_TRANSFER_STATE::OFF, StateType::BALLTRANSER, true};
-        const StateStruc  m_intakeState = {BALL_TRANSFER_STATE::INTAKE, StateType::BALLTRANSER, false};
-        const StateStruc  m_expelState = {BALL_TRANSFER_STATE::EXPEL, StateType::BALLTRANSER, false};
 };
 
 
@@ -14,7 +14,6 @@
 //====================================================================================================================================================
 
 // C++ Includes
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -41,6 +40,34 @@
 
 using namespace std;
 
+namespace
+{
+    constexpr IntakeStateMgr::INTAKE_STATE_MACHINE::StateTable INTAKE_STATES =
+    {{
+        { "INTAKEOFF",   IntakeStateMgr::INTAKE_STATE::OFF,    StateType::INTAKE, true  },
+        { "INTAKEON",    IntakeStateMgr::INTAKE_STATE::INTAKE, StateType::INTAKE, false },
+        { "INTAKEEXPEL", IntakeStateMgr::INTAKE_STATE::EXPEL,  StateType::INTAKE, false }
+    }};
+    static_assert( IntakeStateMgr::INTAKE_STATE_MACHINE::IsValid( INTAKE_STATES ), "intake states must be in state id order" );
+
+    constexpr bool IntakePressed( const TeleopControl::ButtonStates& buttons ) { return buttons[TeleopControl::FUNCTION_IDENTIFIER::INTAKE]; }
+    constexpr bool ExpelPressed( const TeleopControl::ButtonStates& buttons ) { return buttons[TeleopControl::FUNCTION_IDENTIFIER::EXPEL]; }
+    constexpr bool OnlyExpelPressed( const TeleopControl::ButtonStates& buttons ) { return !IntakePressed( buttons ) && ExpelPressed( buttons ); }
+    constexpr bool NothingPressed( const TeleopControl::ButtonStates& buttons ) { return !IntakePressed( buttons ) && !ExpelPressed( buttons ); }
+
+    // intake wins over expel; letting go of both turns the intake off
+    constexpr IntakeStateMgr::INTAKE_STATE_MACHINE::TransitionTable<6> INTAKE_TRANSITIONS =
+    {{
+        { IntakeStateMgr::INTAKE_STATE::OFF,    IntakePressed,    IntakeStateMgr::INTAKE_STATE::INTAKE },
+        { IntakeStateMgr::INTAKE_STATE::OFF,    ExpelPressed,     IntakeStateMgr::INTAKE_STATE::EXPEL  },
+        { IntakeStateMgr::INTAKE_STATE::INTAKE, OnlyExpelPressed, IntakeStateMgr::INTAKE_STATE::EXPEL  },
+        { IntakeStateMgr::INTAKE_STATE::INTAKE, NothingPressed,   IntakeStateMgr::INTAKE_STATE::OFF    },
+        { IntakeStateMgr::INTAKE_STATE::EXPEL,  IntakePressed,    IntakeStateMgr::INTAKE_STATE::INTAKE },
+        { IntakeStateMgr::INTAKE_STATE::EXPEL,  NothingPressed,   IntakeStateMgr::INTAKE_STATE::OFF    }
+    }};
+    static_assert( IntakeStateMgr::INTAKE_STATE_MACHINE::IsValid( INTAKE_TRANSITIONS ), "invalid intake transition" );
+}
+
 
 IntakeStateMgr* IntakeStateMgr::m_instance = nullptr;
 IntakeStateMgr* IntakeStateMgr::GetInstance()
@@ -56,47 +83,16 @@ IntakeStateMgr* IntakeStateMgr::GetInstance()
 /// @brief    initialize the state manager, parse the configuration file and create the states.
 IntakeStateMgr::IntakeStateMgr()
 {
-    map<string, StateStruc> stateMap;
-    stateMap["INTAKEOFF"] = m_offState;
-    stateMap["INTAKEON"] = m_intakeState;
-    stateMap["INTAKEEXPEL"] = m_expelState;
-
-    Init(MechanismFactory::GetMechanismFactory()->GetIntake(), stateMap);
+    Init(MechanismFactory::GetMechanismFactory()->GetIntake(), INTAKE_STATES);
+    SubscribeTo(TeleopControl::FUNCTION_IDENTIFIER::INTAKE);
+    SubscribeTo(TeleopControl::FUNCTION_IDENTIFIER::EXPEL);
 }   
 
-
-/// @brief  run the current state
+/// @brief  move to the state the transition table picks
 /// @return void
 void IntakeStateMgr::CheckForStateTransition()
 {
-    if ( MechanismFactory::GetMechanismFactory()->GetIntake() != nullptr )
-    {
-        // process teleop/manual interrupts
-        auto currentState = static_cast<INTAKE_STATE>(GetCurrentState());
-    
-        auto controller = TeleopControl::GetInstance();
-        if ( controller != nullptr )
-        {
-            auto intakePressed = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::INTAKE);
-            auto expelPressed = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::EXPEL);
-            if (intakePressed  &&  currentState != INTAKE_STATE::INTAKE )
-            {
-                SetCurrentState( INTAKE_STATE::INTAKE, false );
-            }
-            else if (expelPressed && currentState != INTAKE_STATE::EXPEL )
-            {
-                SetCurrentState( INTAKE_STATE::EXPEL, false );
-            }           
-            else if ((!intakePressed && !expelPressed) && currentState != INTAKE_STATE::OFF )
-            {
-                SetCurrentState( INTAKE_STATE::OFF, false );
-            }
-        }
-    }
-
+    // process teleop/manual interrupts
+    auto currentState = static_cast<INTAKE_STATE>(GetCurrentState());
+    SetCurrentState( INTAKE_STATE_MACHINE::NextState( INTAKE_TRANSITIONS, currentState, TeleopControl::GetInstance()->GetButtonStates() ), false );
 }
-
-
-
-
-
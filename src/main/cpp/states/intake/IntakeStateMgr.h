@@ -21,6 +21,7 @@
 // FRC includes
 
 // Team 302 includes
+#include <states/StateMachine.h>
 #include <states/StateMgr.h>
 #include <states/StateStruc.h>
 
@@ -40,6 +41,7 @@ class IntakeStateMgr : public StateMgr
             MAX_INTAKE_STATES
         };
 
+        using INTAKE_STATE_MACHINE = StateMachine<INTAKE_STATE, MAX_INTAKE_STATES, TeleopControl::ButtonStates>;
         
 		/// @brief  Find or create the state manmanager
 		/// @return IntakeStateMgr* pointer to the state manager
@@ -52,10 +54,6 @@ class IntakeStateMgr : public StateMgr
         ~IntakeStateMgr() = default;
 
 		static IntakeStateMgr*	m_instance;
-
-        const StateStruc  m_offState = {INTAKE_STATE::OFF, StateType::INTAKE, true};
-        const StateStruc  m_intakeState = {INTAKE_STATE::INTAKE, StateType::INTAKE, false};
-        const StateStruc  m_expelState = {INTAKE_STATE::EXPEL, StateType::INTAKE, false};
 };
 
 
@@ -0,0 +1,213 @@
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <cmath>
+#include <memory>
+#include <string>
+
+// FRC includes
+#include <frc/Notifier.h>
+#include <frc/RobotController.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <wpi/numbers>
+
+// Team 302 includes
+#include <hw/DragonPigeon.h>
+#include <hw/MotorSensorData.h>
+#include <hw/factories/PigeonFactory.h>
+#include <subsys/Chassis.h>
+
+// Third Party Includes
+
+using namespace std;
+
+Chassis::Chassis
+(
+    units::velocity::meters_per_second_t                maxSpeed,
+    units::angular_velocity::degrees_per_second_t       maxAngSpeed,
+    units::length::inch_t                               wheelDiameter,
+    units::length::inch_t                               track,
+    shared_ptr<ControlData>                             velocityControl,
+    const frc::SimpleMotorFeedforward<units::meters>&   feedforward,
+    string                                              odometryName
+) : IChassis(),
+    m_maxSpeed( maxSpeed ),
+    m_maxAngSpeed( maxAngSpeed ),
+    m_wheelDiameter( wheelDiameter ),
+    m_track( track ),
+    m_velocityControl( velocityControl ),
+    m_feedforward( feedforward ),
+    m_lastDriveTime( 0 ),
+    m_odometryName( odometryName ),
+    m_state( OdometryState{0.0, 0.0, 0.0, 0.0, 0} ),
+    m_resetRequest( OdometryState{0.0, 0.0, 0.0, 0.0, 0} ),
+    m_resets( 0 ),
+    m_appliedResets( 0 ),
+    m_odometryNotifier()
+{
+}
+
+// until the odometry thread applies a reset, the requested pose is the pose; each buffer has a single
+// writer, so the reset isn't written into m_state from this thread
+frc::Pose2d Chassis::GetPose() const
+{
+    auto state = m_state.Read();
+    if ( state.resets != m_resets.load( std::memory_order_acquire ) )
+    {
+        state = m_resetRequest.Read();
+    }
+    return frc::Pose2d(units::meter_t(state.x), units::meter_t(state.y), frc::Rotation2d(units::radian_t(state.heading)));
+}
+
+void Chassis::ResetPose
+(
+    const frc::Pose2d&      pose
+)
+{
+    m_resetRequest.Write(OdometryState{pose.X().to<double>(), pose.Y().to<double>(), pose.Rotation().Radians().to<double>(), 0.0, 0});
+    m_resets.fetch_add(1, std::memory_order_release);
+}
+
+void Chassis::UpdatePose()
+{
+    if (m_odometryNotifier.get() == nullptr)
+    {
+        InitOdometry(GetHeading(), GetPose());
+
+        m_odometryNotifier = make_unique<frc::Notifier>([this] { RunOdometry(); });
+        m_odometryNotifier.get()->SetName(m_odometryName);
+        m_odometryNotifier.get()->StartPeriodic(ODOMETRY_PERIOD);
+    }
+}
+
+void Chassis::RunOdometry()
+{
+    auto heading = GetHeading();
+    auto maxWheelSpeed = 0.0;
+
+    frc::Pose2d pose;
+    auto resets = m_resets.load(std::memory_order_acquire);
+    if (resets != m_appliedResets)
+    {
+        // the request is at least as new as the count read above
+        m_appliedResets = resets;
+        auto request = m_resetRequest.Read();
+        auto resetPose = frc::Pose2d(units::meter_t(request.x), units::meter_t(request.y), frc::Rotation2d(units::radian_t(request.heading)));
+        pose = UpdateOdometry(heading, &resetPose, maxWheelSpeed);
+    }
+    else
+    {
+        pose = UpdateOdometry(heading, nullptr, maxWheelSpeed);
+    }
+
+    m_state.Write(OdometryState{pose.X().to<double>(),
+                                pose.Y().to<double>(),
+                                pose.Rotation().Radians().to<double>(),
+                                maxWheelSpeed,
+                                m_appliedResets});
+}
+
+// destroying the notifier waits for a running callback to finish
+void Chassis::StopOdometry()
+{
+    m_odometryNotifier.reset();
+}
+
+void Chassis::InitDriveMotor
+(
+    IDragonMotorController*     motor
+)
+{
+    if (motor != nullptr)
+    {
+        motor->SetDiameter(m_wheelDiameter.to<double>());
+        if (m_velocityControl.get() != nullptr)
+        {
+            motor->SetControlConstants(0, m_velocityControl.get());
+        }
+    }
+}
+
+void Chassis::SetWheelVelocity
+(
+    IDragonMotorController*                 motor,
+    units::meters_per_second_t              speed,
+    units::meters_per_second_squared_t      acceleration
+)
+{
+    if (motor != nullptr)
+    {
+        // the controller takes the feed forward as percent output, so scale by what the battery can supply
+        auto volts = m_feedforward.Calculate(speed, acceleration);
+        auto battery = frc::RobotController::GetBatteryVoltage();
+        auto feedforward = battery > units::volt_t(1.0) ? (volts / battery).to<double>() : 0.0;
+        motor->SetWithFeedForward(units::inch_t(units::meter_t(speed.to<double>())).to<double>(), feedforward);   // inches per second
+    }
+}
+
+//Reads the controller directly rather than the once per loop sensor snapshot, which is
+//only refreshed at the robot loop rate (and on the robot loop thread)
+void Chassis::GetWheelTravel
+(
+    IDragonMotorController*     motor,
+    units::meter_t&             distance,
+    units::meters_per_second_t& speed
+) const
+{
+    distance = units::meter_t(0);
+    speed = units::meters_per_second_t(0);
+    if (motor != nullptr)
+    {
+        MotorSensorData data;
+        motor->ReadSensors(data);
+        auto countsPerWheelRev = motor->GetCountsPerRev() * motor->GetGearRatio();
+        auto circumference = units::meter_t(m_wheelDiameter).to<double>() * wpi::numbers::pi;
+        distance = units::meter_t(circumference * data.position / countsPerWheelRev);
+        speed = units::meters_per_second_t(circumference * data.velocity * 10.0 / countsPerWheelRev);   // velocity is per 100ms
+    }
+}
+
+frc::Rotation2d Chassis::GetHeading() const
+{
+    auto pigeon = PigeonFactory::GetFactory()->GetPigeon();
+    return pigeon != nullptr ? frc::Rotation2d(units::degree_t(pigeon->GetYaw())) : frc::Rotation2d();
+}
+
+units::velocity::meters_per_second_t Chassis::GetMaxSpeed() const
+{
+    return m_maxSpeed;
+}
+
+units::angular_velocity::degrees_per_second_t Chassis::GetMaxAngularSpeed() const
+{
+    return m_maxAngSpeed;
+}
+
+units::length::inch_t Chassis::GetWheelDiameter() const
+{
+    return m_wheelDiameter;
+}
+
+units::length::inch_t Chassis::GetTrack() const
+{
+    return m_track;
+}
+
+bool Chassis::IsMoving() const
+{
+    return m_state.Read().maxWheelSpeed > MOVING_SPEED;
+}
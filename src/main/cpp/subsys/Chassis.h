@@ -0,0 +1,192 @@
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// Chassis.h
+//========================================================================================================
+///
+/// File Description:
+///     Common part of the differential, mecanum and swerve chassis: the drive wheel velocity setpoints
+///     with feed forward, reading the drive wheel encoders and the pigeon heading, and the odometry
+///     notifier that publishes the pose.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <atomic>
+#include <memory>
+#include <string>
+
+// FRC includes
+#include <frc/Notifier.h>
+#include <frc/controller/SimpleMotorFeedforward.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+
+// Team 302 includes
+#include <controllers/ControlData.h>
+#include <hw/interfaces/IDragonMotorController.h>
+#include <subsys/interfaces/IChassis.h>
+#include <utils/DoubleBuffer.h>
+
+// Third Party Includes
+#include <units/acceleration.h>
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+
+///	 @class Chassis
+///  @brief	    Base class for the chassis.  The derived chassis turn chassis speeds into wheel setpoints
+///             and own the WPILib odometry; this class runs that odometry on its own notifier.
+class Chassis : public IChassis
+{
+	public:
+
+        /// @brief get the latest pose from the odometry thread
+        /// @return frc::Pose2d field relative pose
+        frc::Pose2d GetPose() const override;
+
+        /// @brief hand the pose to the odometry thread; GetPose returns it right away and the odometry
+        ///        is reset on its next update
+        /// @param [in] const frc::Pose2d& pose - new field relative pose
+        void ResetPose
+        (
+            const frc::Pose2d&      pose
+        ) override;
+
+        /// @brief start the odometry notifier the first time the robot loop asks for a pose update,
+        ///        so the pigeon and motor controllers have all been created
+        void UpdatePose() override;
+
+        units::velocity::meters_per_second_t GetMaxSpeed() const override;
+        units::angular_velocity::degrees_per_second_t GetMaxAngularSpeed() const override;
+        units::length::inch_t GetWheelDiameter() const override;
+        units::length::inch_t GetTrack() const override;
+
+        /// @brief is any drive wheel turning faster than MOVING_SPEED
+        /// @return bool - true if the chassis is moving
+        bool IsMoving() const override;
+
+	    Chassis() = delete;
+	    virtual ~Chassis() = default;
+
+    protected:
+        /// @brief create the common part of a chassis
+        /// @param [in] maxSpeed - fastest wheel speed
+        /// @param [in] maxAngSpeed - fastest rotation
+        /// @param [in] wheelDiameter - drive wheel diameter
+        /// @param [in] track - distance between the left and right wheels
+        /// @param [in] velocityControl - drive wheel velocity constants (nullptr drives in percent output)
+        /// @param [in] feedforward - drive wheel kS/kV/kA
+        /// @param [in] odometryName - name of the odometry notifier thread
+        Chassis
+        (
+            units::velocity::meters_per_second_t                maxSpeed,
+            units::angular_velocity::degrees_per_second_t       maxAngSpeed,
+            units::length::inch_t                               wheelDiameter,
+            units::length::inch_t                               track,
+            std::shared_ptr<ControlData>                        velocityControl,
+            const frc::SimpleMotorFeedforward<units::meters>&   feedforward,
+            std::string                                         odometryName
+        );
+
+        /// @brief create the odometry from the current wheel encoders (called before the notifier starts)
+        /// @param [in] const frc::Rotation2d& heading - pigeon heading
+        /// @param [in] const frc::Pose2d& pose - starting pose
+        virtual void InitOdometry
+        (
+            const frc::Rotation2d&  heading,
+            const frc::Pose2d&      pose
+        ) = 0;
+
+        /// @brief read the wheel encoders and update (or reset) the odometry (runs on the odometry notifier thread)
+        /// @param [in] const frc::Rotation2d& heading - pigeon heading
+        /// @param [in] const frc::Pose2d* resetPose - pose to reset to, nullptr to integrate the wheels
+        /// @param [out] double& maxWheelSpeed - fastest wheel speed (meters per second)
+        /// @return frc::Pose2d the updated pose
+        virtual frc::Pose2d UpdateOdometry
+        (
+            const frc::Rotation2d&  heading,
+            const frc::Pose2d*      resetPose,
+            double&                 maxWheelSpeed
+        ) = 0;
+
+        /// @brief stop the odometry notifier; derived destructors call this before the odometry it
+        ///        updates is destroyed
+        void StopOdometry();
+
+        /// @brief set the wheel diameter and velocity constants on a drive motor
+        void InitDriveMotor
+        (
+            IDragonMotorController*     motor
+        );
+
+        /// @brief send a wheel speed as a velocity setpoint plus the kS/kV/kA feed forward
+        void SetWheelVelocity
+        (
+            IDragonMotorController*                 motor,
+            units::meters_per_second_t              speed,
+            units::meters_per_second_squared_t      acceleration
+        );
+
+        /// @brief distance (meters) and speed (meters per second) a drive wheel has traveled (zero if there is no motor)
+        void GetWheelTravel
+        (
+            IDragonMotorController*     motor,
+            units::meter_t&             distance,
+            units::meters_per_second_t& speed
+        ) const;
+
+        /// @brief heading from the pigeon (zero if there isn't one)
+        frc::Rotation2d GetHeading() const;
+
+        units::velocity::meters_per_second_t            m_maxSpeed;
+        units::angular_velocity::degrees_per_second_t   m_maxAngSpeed;
+        units::length::inch_t                           m_wheelDiameter;
+        units::length::inch_t                           m_track;
+        std::shared_ptr<ControlData>                    m_velocityControl;      // nullptr drives in percent output
+        frc::SimpleMotorFeedforward<units::meters>      m_feedforward;
+        units::second_t                                 m_lastDriveTime;        // for the setpoint acceleration
+
+        static constexpr units::second_t    ODOMETRY_PERIOD = units::millisecond_t(IDragonMotorController::ODOMETRY_FEEDBACK_PERIOD_MS);  // drive feedback frame rate
+        static constexpr double             MOVING_SPEED = 0.05;                        // meters per second
+
+    private:
+        /// @brief pose and fastest wheel speed published by the odometry thread
+        struct OdometryState
+        {
+            double          x;              // meters
+            double          y;              // meters
+            double          heading;        // radians
+            double          maxWheelSpeed;  // meters per second
+            unsigned int    resets;         // ResetPose calls applied to this pose
+        };
+
+        /// @brief notifier callback: apply a pending reset or integrate the wheels, then publish the pose
+        void RunOdometry();
+
+        std::string                         m_odometryName;
+        DoubleBuffer<OdometryState>         m_state;            // latest pose for GetPose/IsMoving
+        DoubleBuffer<OdometryState>         m_resetRequest;     // pose requested by ResetPose
+        std::atomic<unsigned int>           m_resets;           // ResetPose calls
+        unsigned int                        m_appliedResets;    // only used on the odometry thread
+
+        // declared last so it stops before anything it uses is destroyed
+        std::unique_ptr<frc::Notifier>      m_odometryNotifier;
+};
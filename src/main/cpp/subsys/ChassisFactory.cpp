@@ -9,6 +9,8 @@
 
 #include <subsys/interfaces/IChassis.h>
 #include <subsys/DifferentialChassis.h>
+#include <subsys/MecanumChassis.h>
+#include <subsys/SwerveChassis.h>
 #include <subsys/ChassisFactory.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/usages/IDragonMotorControllerMap.h>
@@ -32,6 +34,14 @@ IChassis* ChassisFactory::GetIChassis()
     return m_chassis;
 }
 
+void ChassisFactory::SetIChassis
+(
+    IChassis*       chassis
+)
+{
+    m_chassis = chassis;
+}
+
 //=======================================================================================
 // Method:  		CreateChassis
 // Description:		Create a chassis from the inputs
@@ -47,7 +57,11 @@ IChassis* ChassisFactory::CreateChassis
     units::radians_per_second_t 								maxAngularSpeed,
     units::acceleration::meters_per_second_squared_t 			maxAcceleration,
     units::angular_acceleration::radians_per_second_squared_t 	maxAngularAcceleration,
- 	const IDragonMotorControllerMap&                            motors 		        // <I> - Motor Controllers
+ 	const IDragonMotorControllerMap&                            motors, 	        // <I> - Motor Controllers
+    shared_ptr<ControlData>                                     velocityControl,    // <I> - drive wheel velocity loop (nullptr for percent output)
+    const frc::SimpleMotorFeedforward<units::meters>&           feedforward,        // <I> - drive wheel kS/kV/kA
+    const map<string, shared_ptr<ctre::phoenix::sensors::CANCoder>>& canCoders,     // <I> - swerve module angle sensors (by usage)
+    shared_ptr<ControlData>                                     turnControl         // <I> - swerve turn motor position loop
 )
 {
     switch ( type )
@@ -61,20 +75,51 @@ IChassis* ChassisFactory::CreateChassis
                                                 track,
                                                 maxVelocity,
                                                 maxAngularSpeed,
-                                                wheelDiameter);
+                                                wheelDiameter,
+                                                velocityControl,
+                                                feedforward);
 
         }
         break;
 
         case ChassisFactory::CHASSIS_TYPE::MECANUM_CHASSIS:
         {
-            // todo plug in mecanum drive
+            m_chassis = new MecanumChassis(GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_FRONT_LEFT),
+                                           GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_FRONT_RIGHT),
+                                           GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_BACK_LEFT),
+                                           GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::MECANUM_BACK_RIGHT),
+                                           wheelBase,
+                                           track,
+                                           maxVelocity,
+                                           maxAngularSpeed,
+                                           wheelDiameter,
+                                           velocityControl,
+                                           feedforward);
         }
         break;
 
         case ChassisFactory::CHASSIS_TYPE::SWERVE_CHASSIS:
         {
-            // todo plug in swerve drive
+            m_chassis = new SwerveChassis(GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_LEFT_DRIVE),
+                                          GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_LEFT_TURN),
+                                          GetCanCoder(canCoders, string("SWERVE_FRONT_LEFT")),
+                                          GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_RIGHT_DRIVE),
+                                          GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_FRONT_RIGHT_TURN),
+                                          GetCanCoder(canCoders, string("SWERVE_FRONT_RIGHT")),
+                                          GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_LEFT_DRIVE),
+                                          GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_LEFT_TURN),
+                                          GetCanCoder(canCoders, string("SWERVE_BACK_LEFT")),
+                                          GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_RIGHT_DRIVE),
+                                          GetMotorController(motors, MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_BACK_RIGHT_TURN),
+                                          GetCanCoder(canCoders, string("SWERVE_BACK_RIGHT")),
+                                          wheelBase,
+                                          track,
+                                          maxVelocity,
+                                          maxAngularSpeed,
+                                          wheelDiameter,
+                                          velocityControl,
+                                          feedforward,
+                                          turnControl);
         }
         break;
 
@@ -113,4 +158,23 @@ shared_ptr<IDragonMotorController> ChassisFactory::GetMotorController
 	return motor;
 }
 
-
+shared_ptr<ctre::phoenix::sensors::CANCoder> ChassisFactory::GetCanCoder
+(
+	const map<string, shared_ptr<ctre::phoenix::sensors::CANCoder>>&	canCoders,
+	const string&														usage
+)
+{
+	shared_ptr<ctre::phoenix::sensors::CANCoder> canCoder;
+	auto it = canCoders.find( usage );
+	if ( it != canCoders.end() )  // found it
+	{
+		canCoder = it->second;
+	}
+	else
+	{
+		string msg = "cancoder not found; usage = ";
+		msg += usage;
+		Logger::GetLogger()->LogError( string( "ChassisFactory::GetCanCoder" ), msg );
+	}
+	return canCoder;
+}
@@ -5,9 +5,16 @@
 #include <units/angular_velocity.h>
 #include <units/length.h>
 #include <units/velocity.h>
+#include <frc/controller/SimpleMotorFeedforward.h>
 
 
+#include <map>
 #include <memory>
+#include <string>
+
+#include <ctre/phoenix/sensors/CANCoder.h>
+
+#include <controllers/ControlData.h>
 
 #include <subsys/interfaces/IChassis.h>
 #include <hw/interfaces/IDragonMotorController.h>
@@ -29,6 +36,17 @@ class ChassisFactory
 
 			IChassis* GetIChassis();
 
+			//=======================================================================================
+			// Method:  		SetIChassis
+			// Description:		Use a chassis that wasn't built from the robot definition (the
+			//					desktop auton simulator installs its model here)
+			// Returns:         Void
+			//=======================================================================================
+			void SetIChassis
+			(
+				IChassis*		chassis				// <I> - chassis the primitives will drive
+			);
+
 			//=======================================================================================
 			// Method:  		CreateChassis
 			// Description:		Create a chassis from the inputs
@@ -44,7 +62,11 @@ class ChassisFactory
 				units::radians_per_second_t 								maxAngularSpeed,
 				units::acceleration::meters_per_second_squared_t 			maxAcceleration,
 				units::angular_acceleration::radians_per_second_squared_t 	maxAngularAcceleration,
-				const IDragonMotorControllerMap&    						motors 		        // <I> - Motor Controllers
+				const IDragonMotorControllerMap&    						motors, 	        // <I> - Motor Controllers
+				std::shared_ptr<ControlData>								velocityControl,	// <I> - drive wheel velocity loop (nullptr for percent output)
+				const frc::SimpleMotorFeedforward<units::meters>&			feedforward,		// <I> - drive wheel kS/kV/kA
+				const std::map<std::string, std::shared_ptr<ctre::phoenix::sensors::CANCoder>>&	canCoders,	// <I> - swerve module angle sensors (by usage)
+				std::shared_ptr<ControlData>								turnControl			// <I> - swerve turn motor position loop
 			);
 
 		private:
@@ -53,6 +75,11 @@ class ChassisFactory
 				const IDragonMotorControllerMap&				motorControllers,
 				MotorControllerUsage::MOTOR_CONTROLLER_USAGE	usage
 			);
+			std::shared_ptr<ctre::phoenix::sensors::CANCoder> GetCanCoder
+			(
+				const std::map<std::string, std::shared_ptr<ctre::phoenix::sensors::CANCoder>>&	canCoders,
+				const std::string&																usage
+			);
 			ChassisFactory() = default;
 			~ChassisFactory() = default;
 			IChassis*        m_chassis;
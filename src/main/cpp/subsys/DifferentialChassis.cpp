@@ -3,6 +3,10 @@
 #include <frc/kinematics/DifferentialDriveKinematics.h>
 #include <frc/drive/DifferentialDrive.h>
 #include <frc/kinematics/DifferentialDriveOdometry.h>
+#include <frc/Timer.h>
+
+#include <algorithm>
+#include <cmath>
 
 using namespace std;
 
@@ -11,24 +15,59 @@ DifferentialChassis::DifferentialChassis(shared_ptr<IDragonMotorController> left
                         units::meter_t trackWidth,
                         units::velocity::meters_per_second_t maxSpeed,
                         units::angular_velocity::degrees_per_second_t maxAngSpeed,
-                        units::length::inch_t wheelDiameter) : m_leftMotor(leftMotor),
+                        units::length::inch_t wheelDiameter,
+                        shared_ptr<ControlData> velocityControl,
+                        const frc::SimpleMotorFeedforward<units::meters>& feedforward) : Chassis(maxSpeed,
+                                                            maxAngSpeed,
+                                                            wheelDiameter,
+                                                            trackWidth,
+                                                            velocityControl,
+                                                            feedforward,
+                                                            "DifferentialChassisOdometry"),
+                                                    m_leftMotor(leftMotor),
                                                     m_rightMotor(rightMotor),
-                                                    m_maxSpeed(maxSpeed),
-                                                    m_maxAngSpeed(maxAngSpeed),
-                                                    m_wheelDiameter(wheelDiameter),
-                                                    m_track(trackWidth),
-                                                    m_kinematics(new frc::DifferentialDriveKinematics(trackWidth))
+                                                    m_kinematics(new frc::DifferentialDriveKinematics(trackWidth)),
+                                                    m_lastWheelSpeeds(),
                                                     //m_differentialDrive(new frc::DifferentialDrive(*leftMotor.GetSpeedController().get(), 
                                                     //                                               *rightMotor.GetSpeedController().get())),
-                                                    //m_differentialOdometry(new frc::DifferentialDriveOdometry(frc::Rotation2d(), frc::Pose2d()))
-                                                    // TODO: add left and right encoder trvael
+                                                    m_differentialOdometry()
+
+    {
+        InitDriveMotor(m_leftMotor.get());
+        InitDriveMotor(m_rightMotor.get());
+    }
+
+    //The odometry notifier uses the odometry, so stop it first
+    DifferentialChassis::~DifferentialChassis()
+    {
+        StopOdometry();
+    }
 
-    {}
     //Moves the robot
     void DifferentialChassis::Drive(frc::ChassisSpeeds chassisSpeeds)
     {
         auto wheels = m_kinematics->ToWheelSpeeds(chassisSpeeds);
         wheels.Desaturate(m_maxSpeed);
+        if (m_velocityControl.get() != nullptr)
+        {
+            // acceleration from the change in setpoint since the last call; ignore it after a pause
+            auto now = frc::Timer::GetFPGATimestamp();
+            auto dt = now - m_lastDriveTime;
+            auto leftAccel = units::meters_per_second_squared_t(0);
+            auto rightAccel = units::meters_per_second_squared_t(0);
+            if (dt > units::second_t(0) && dt < units::second_t(0.1))
+            {
+                leftAccel = (wheels.left - m_lastWheelSpeeds.left) / dt;
+                rightAccel = (wheels.right - m_lastWheelSpeeds.right) / dt;
+            }
+            m_lastWheelSpeeds = wheels;
+            m_lastDriveTime = now;
+
+            SetWheelVelocity(m_leftMotor.get(), wheels.left, leftAccel);
+            SetWheelVelocity(m_rightMotor.get(), wheels.right, rightAccel);
+            return;
+        }
+
         if (m_leftMotor.get() != nullptr)
         {
             m_leftMotor.get()->Set(wheels.left/m_maxSpeed);
@@ -44,41 +83,46 @@ DifferentialChassis::DifferentialChassis(shared_ptr<IDragonMotorController> left
         //m_differentialDrive->ArcadeDrive(xPercent, omegaPercent, false);
     }
 
-    frc::Pose2d DifferentialChassis::GetPose() const
-    {
-        return frc::Pose2d();
-    }
-
-    void DifferentialChassis::ResetPose(const frc::Pose2d& pose)
-    {
-
-    }
-
-    void DifferentialChassis::UpdatePose()
+    //A tank drive can't strafe, so the driver's sticks already are robot relative
+    void DifferentialChassis::DriveFieldOriented(frc::ChassisSpeeds fieldSpeeds)
     {
-        
+        Drive(fieldSpeeds);
     }
 
-    units::velocity::meters_per_second_t DifferentialChassis::GetMaxSpeed() const
+    bool DifferentialChassis::IsHolonomic() const
     {
-        return m_maxSpeed;
+        return false;
     }
 
-    units::angular_velocity::degrees_per_second_t DifferentialChassis::GetMaxAngularSpeed() const
+    void DifferentialChassis::InitOdometry(const frc::Rotation2d& heading, const frc::Pose2d& pose)
     {
-        return m_maxAngSpeed;
+        units::meter_t left{0};
+        units::meter_t right{0};
+        units::meters_per_second_t speed{0};
+        GetWheelTravel(m_leftMotor.get(), left, speed);
+        GetWheelTravel(m_rightMotor.get(), right, speed);
+        m_differentialOdometry = make_unique<frc::DifferentialDriveOdometry>(heading, left, right, pose);
     }
 
-    units::length::inch_t DifferentialChassis::GetWheelDiameter() const
+    frc::Pose2d DifferentialChassis::UpdateOdometry
+    (
+        const frc::Rotation2d&  heading,
+        const frc::Pose2d*      resetPose,
+        double&                 maxWheelSpeed
+    )
     {
-        return units::length::inch_t(4);
-    }    
+        units::meter_t left{0};
+        units::meter_t right{0};
+        units::meters_per_second_t leftSpeed{0};
+        units::meters_per_second_t rightSpeed{0};
+        GetWheelTravel(m_leftMotor.get(), left, leftSpeed);
+        GetWheelTravel(m_rightMotor.get(), right, rightSpeed);
+        maxWheelSpeed = max(abs(leftSpeed.to<double>()), abs(rightSpeed.to<double>()));
 
-    units::length::inch_t DifferentialChassis::GetTrack() const
-    {
-        return m_track;
+        if (resetPose != nullptr)
+        {
+            m_differentialOdometry.get()->ResetPosition(heading, left, right, *resetPose);
+            return *resetPose;
+        }
+        return m_differentialOdometry.get()->Update(heading, left, right);
     }
-    bool DifferentialChassis::IsMoving() const
-    {
-        return false;
-    }
\ No newline at end of file
@@ -1,51 +1,51 @@
 #pragma once
 
+#include <memory>
+
 #include <units/velocity.h>
 #include <units/angular_velocity.h>
+#include <units/acceleration.h>
 
-#include <subsys/interfaces/IChassis.h>
+#include <subsys/Chassis.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <frc/kinematics/DifferentialDriveKinematics.h>
 #include <frc/kinematics/DifferentialDriveOdometry.h>
+#include <frc/kinematics/DifferentialDriveWheelSpeeds.h>
 #include <frc/drive/DifferentialDrive.h>
+#include <frc/controller/SimpleMotorFeedforward.h>
+#include <units/time.h>
+#include <controllers/ControlData.h>
 
-class DifferentialChassis : public IChassis {
+class DifferentialChassis : public Chassis {
 
     public:
         DifferentialChassis() = delete;
-        virtual ~DifferentialChassis() = default;
+        virtual ~DifferentialChassis();
 
         DifferentialChassis(std::shared_ptr<IDragonMotorController> leftMotor, 
                         std::shared_ptr<IDragonMotorController> rightMotor,
                         units::meter_t trackWidth,
                         units::velocity::meters_per_second_t maxSpeed,
                         units::angular_velocity::degrees_per_second_t maxAngSpeed,
-                        units::length::inch_t wheelDiameter);
+                        units::length::inch_t wheelDiameter,
+                        std::shared_ptr<ControlData> velocityControl,
+                        const frc::SimpleMotorFeedforward<units::meters>& feedforward);
 
         void Drive(frc::ChassisSpeeds chassisSpeeds) override;
+        void DriveFieldOriented(frc::ChassisSpeeds fieldSpeeds) override;
+        bool IsHolonomic() const override;
 
-        frc::Pose2d GetPose() const override;
-        void ResetPose(const frc::Pose2d& pose) override;
-        void UpdatePose() override;
-        units::velocity::meters_per_second_t GetMaxSpeed() const override;
-        units::angular_velocity::degrees_per_second_t GetMaxAngularSpeed() const override;
-
-        units::length::inch_t GetWheelDiameter() const override ;
-        units::length::inch_t GetTrack() const override;
-
-        bool IsMoving() const override;
+    protected:
+        void InitOdometry(const frc::Rotation2d& heading, const frc::Pose2d& pose) override;
+        frc::Pose2d UpdateOdometry(const frc::Rotation2d& heading, const frc::Pose2d* resetPose, double& maxWheelSpeed) override;
 
     private:
         std::shared_ptr<IDragonMotorController> m_leftMotor;
         std::shared_ptr<IDragonMotorController> m_rightMotor;
-        
-        units::velocity::meters_per_second_t m_maxSpeed;
-        units::angular_velocity::degrees_per_second_t m_maxAngSpeed;
-        units::length::inch_t   m_wheelDiameter;
-        units::length::inch_t   m_track;
 
         frc::DifferentialDriveKinematics*  m_kinematics;
+        frc::DifferentialDriveWheelSpeeds   m_lastWheelSpeeds;     // last velocity setpoints (for acceleration)
         //frc::DifferentialDrive*             m_differentialDrive;
-        frc::DifferentialDriveOdometry*     m_differentialOdometry;
+        std::unique_ptr<frc::DifferentialDriveOdometry> m_differentialOdometry;   // only used on the odometry thread
 
-};
\ No newline at end of file
+};
@@ -0,0 +1,151 @@
+#include <subsys/MecanumChassis.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/kinematics/MecanumDriveKinematics.h>
+#include <frc/kinematics/MecanumDriveOdometry.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/Timer.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+MecanumChassis::MecanumChassis(shared_ptr<IDragonMotorController> frontLeftMotor,
+                               shared_ptr<IDragonMotorController> frontRightMotor,
+                               shared_ptr<IDragonMotorController> backLeftMotor,
+                               shared_ptr<IDragonMotorController> backRightMotor,
+                               units::length::inch_t wheelBase,
+                               units::length::inch_t track,
+                               units::velocity::meters_per_second_t maxSpeed,
+                               units::angular_velocity::degrees_per_second_t maxAngSpeed,
+                               units::length::inch_t wheelDiameter,
+                               shared_ptr<ControlData> velocityControl,
+                               const frc::SimpleMotorFeedforward<units::meters>& feedforward) : Chassis(maxSpeed,
+                                                            maxAngSpeed,
+                                                            wheelDiameter,
+                                                            track,
+                                                            velocityControl,
+                                                            feedforward,
+                                                            "MecanumChassisOdometry"),
+                                                    m_frontLeftMotor(frontLeftMotor),
+                                                    m_frontRightMotor(frontRightMotor),
+                                                    m_backLeftMotor(backLeftMotor),
+                                                    m_backRightMotor(backRightMotor),
+                                                    m_kinematics(frc::Translation2d(wheelBase / 2.0, track / 2.0),
+                                                                 frc::Translation2d(wheelBase / 2.0, -track / 2.0),
+                                                                 frc::Translation2d(-wheelBase / 2.0, track / 2.0),
+                                                                 frc::Translation2d(-wheelBase / 2.0, -track / 2.0)),
+                                                    m_lastWheelSpeeds(),
+                                                    m_mecanumOdometry()
+    {
+        for (auto motor : {m_frontLeftMotor.get(), m_frontRightMotor.get(), m_backLeftMotor.get(), m_backRightMotor.get()})
+        {
+            InitDriveMotor(motor);
+        }
+    }
+
+    //The odometry notifier uses the odometry, so stop it first
+    MecanumChassis::~MecanumChassis()
+    {
+        StopOdometry();
+    }
+
+    //Moves the robot (robot relative speeds)
+    void MecanumChassis::Drive(frc::ChassisSpeeds chassisSpeeds)
+    {
+        // scale all four wheels together so a saturated wheel doesn't bend the path
+        auto wheels = m_kinematics.ToWheelSpeeds(chassisSpeeds);
+        wheels.Desaturate(m_maxSpeed);
+
+        if (m_velocityControl.get() != nullptr)
+        {
+            // acceleration from the change in setpoint since the last call; ignore it after a pause
+            auto now = frc::Timer::GetFPGATimestamp();
+            auto dt = now - m_lastDriveTime;
+            auto useAccel = dt > units::second_t(0) && dt < units::second_t(0.1);
+            auto accel = [&](units::meters_per_second_t speed, units::meters_per_second_t lastSpeed)
+            {
+                return useAccel ? (speed - lastSpeed) / dt : units::meters_per_second_squared_t(0);
+            };
+
+            SetWheelVelocity(m_frontLeftMotor.get(), wheels.frontLeft, accel(wheels.frontLeft, m_lastWheelSpeeds.frontLeft));
+            SetWheelVelocity(m_frontRightMotor.get(), wheels.frontRight, accel(wheels.frontRight, m_lastWheelSpeeds.frontRight));
+            SetWheelVelocity(m_backLeftMotor.get(), wheels.rearLeft, accel(wheels.rearLeft, m_lastWheelSpeeds.rearLeft));
+            SetWheelVelocity(m_backRightMotor.get(), wheels.rearRight, accel(wheels.rearRight, m_lastWheelSpeeds.rearRight));
+
+            m_lastWheelSpeeds = wheels;
+            m_lastDriveTime = now;
+            return;
+        }
+
+        if (m_frontLeftMotor.get() != nullptr)
+        {
+            m_frontLeftMotor.get()->Set(wheels.frontLeft/m_maxSpeed);
+        }
+        if (m_frontRightMotor.get() != nullptr)
+        {
+            m_frontRightMotor.get()->Set(wheels.frontRight/m_maxSpeed);
+        }
+        if (m_backLeftMotor.get() != nullptr)
+        {
+            m_backLeftMotor.get()->Set(wheels.rearLeft/m_maxSpeed);
+        }
+        if (m_backRightMotor.get() != nullptr)
+        {
+            m_backRightMotor.get()->Set(wheels.rearRight/m_maxSpeed);
+        }
+    }
+
+    //Rotates field relative speeds into the robot frame using the pigeon yaw
+    void MecanumChassis::DriveFieldOriented(frc::ChassisSpeeds fieldSpeeds)
+    {
+        Drive(frc::ChassisSpeeds::FromFieldRelativeSpeeds(fieldSpeeds.vx, fieldSpeeds.vy, fieldSpeeds.omega, GetHeading()));
+    }
+
+    bool MecanumChassis::IsHolonomic() const
+    {
+        return true;
+    }
+
+    void MecanumChassis::InitOdometry(const frc::Rotation2d& heading, const frc::Pose2d& pose)
+    {
+        auto speed = 0.0;
+        m_mecanumOdometry = make_unique<frc::MecanumDriveOdometry>(m_kinematics, heading, GetWheelPositions(speed), pose);
+    }
+
+    frc::Pose2d MecanumChassis::UpdateOdometry
+    (
+        const frc::Rotation2d&  heading,
+        const frc::Pose2d*      resetPose,
+        double&                 maxWheelSpeed
+    )
+    {
+        auto positions = GetWheelPositions(maxWheelSpeed);
+        if (resetPose != nullptr)
+        {
+            m_mecanumOdometry.get()->ResetPosition(heading, positions, *resetPose);
+            return *resetPose;
+        }
+        return m_mecanumOdometry.get()->Update(heading, positions);
+    }
+
+    frc::MecanumDriveWheelPositions MecanumChassis::GetWheelPositions
+    (
+        double& maxWheelSpeed
+    ) const
+    {
+        frc::MecanumDriveWheelPositions positions;
+        units::meters_per_second_t speed{0};
+        maxWheelSpeed = 0.0;
+
+        GetWheelTravel(m_frontLeftMotor.get(), positions.frontLeft, speed);
+        maxWheelSpeed = max(maxWheelSpeed, abs(speed.to<double>()));
+        GetWheelTravel(m_frontRightMotor.get(), positions.frontRight, speed);
+        maxWheelSpeed = max(maxWheelSpeed, abs(speed.to<double>()));
+        GetWheelTravel(m_backLeftMotor.get(), positions.rearLeft, speed);
+        maxWheelSpeed = max(maxWheelSpeed, abs(speed.to<double>()));
+        GetWheelTravel(m_backRightMotor.get(), positions.rearRight, speed);
+        maxWheelSpeed = max(maxWheelSpeed, abs(speed.to<double>()));
+
+        return positions;
+    }
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+
+#include <units/velocity.h>
+#include <units/angular_velocity.h>
+#include <units/acceleration.h>
+#include <units/time.h>
+
+#include <subsys/Chassis.h>
+#include <hw/interfaces/IDragonMotorController.h>
+#include <frc/kinematics/MecanumDriveKinematics.h>
+#include <frc/kinematics/MecanumDriveOdometry.h>
+#include <frc/kinematics/MecanumDriveWheelPositions.h>
+#include <frc/kinematics/MecanumDriveWheelSpeeds.h>
+#include <frc/controller/SimpleMotorFeedforward.h>
+#include <controllers/ControlData.h>
+
+/// @class MecanumChassis : public Chassis {
+
+    public:
+        MecanumChassis() = delete;
+        virtual ~MecanumChassis();
+
+        MecanumChassis(std::shared_ptr<IDragonMotorController> frontLeftMotor,
+                       std::shared_ptr<IDragonMotorController> frontRightMotor,
+                       std::shared_ptr<IDragonMotorController> backLeftMotor,
+                       std::shared_ptr<IDragonMotorController> backRightMotor,
+                       units::length::inch_t wheelBase,
+                       units::length::inch_t track,
+                       units::velocity::meters_per_second_t maxSpeed,
+                       units::angular_velocity::degrees_per_second_t maxAngSpeed,
+                       units::length::inch_t wheelDiameter,
+                       std::shared_ptr<ControlData> velocityControl,
+                       const frc::SimpleMotorFeedforward<units::meters>& feedforward);
+
+        void Drive(frc::ChassisSpeeds chassisSpeeds) override;
+        void DriveFieldOriented(frc::ChassisSpeeds fieldSpeeds) override;
+        bool IsHolonomic() const override;
+
+    protected:
+        void InitOdometry(const frc::Rotation2d& heading, const frc::Pose2d& pose) override;
+        frc::Pose2d UpdateOdometry(const frc::Rotation2d& heading, const frc::Pose2d* resetPose, double& maxWheelSpeed) override;
+
+    private:
+        /// @brief distance each wheel has traveled, plus the fastest wheel speed (meters per second)
+        frc::MecanumDriveWheelPositions GetWheelPositions(double& maxWheelSpeed) const;
+
+        std::shared_ptr<IDragonMotorController> m_frontLeftMotor;
+        std::shared_ptr<IDragonMotorController> m_frontRightMotor;
+        std::shared_ptr<IDragonMotorController> m_backLeftMotor;
+        std::shared_ptr<IDragonMotorController> m_backRightMotor;
+
+        frc::MecanumDriveKinematics         m_kinematics;
+        frc::MecanumDriveWheelSpeeds        m_lastWheelSpeeds;      // last velocity setpoints (for acceleration)
+        std::unique_ptr<frc::MecanumDriveOdometry> m_mecanumOdometry;   // only used on the odometry thread
+
+};
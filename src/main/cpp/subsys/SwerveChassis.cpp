@@ -0,0 +1,216 @@
+#include <subsys/SwerveChassis.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/kinematics/SwerveDriveKinematics.h>
+#include <frc/kinematics/SwerveDriveOdometry.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/Timer.h>
+#include <wpi/numbers>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+SwerveChassis::SwerveChassis(shared_ptr<IDragonMotorController> frontLeftDrive,
+                             shared_ptr<IDragonMotorController> frontLeftTurn,
+                             shared_ptr<ctre::phoenix::sensors::CANCoder> frontLeftCanCoder,
+                             shared_ptr<IDragonMotorController> frontRightDrive,
+                             shared_ptr<IDragonMotorController> frontRightTurn,
+                             shared_ptr<ctre::phoenix::sensors::CANCoder> frontRightCanCoder,
+                             shared_ptr<IDragonMotorController> backLeftDrive,
+                             shared_ptr<IDragonMotorController> backLeftTurn,
+                             shared_ptr<ctre::phoenix::sensors::CANCoder> backLeftCanCoder,
+                             shared_ptr<IDragonMotorController> backRightDrive,
+                             shared_ptr<IDragonMotorController> backRightTurn,
+                             shared_ptr<ctre::phoenix::sensors::CANCoder> backRightCanCoder,
+                             units::length::inch_t wheelBase,
+                             units::length::inch_t track,
+                             units::velocity::meters_per_second_t maxSpeed,
+                             units::angular_velocity::degrees_per_second_t maxAngSpeed,
+                             units::length::inch_t wheelDiameter,
+                             shared_ptr<ControlData> velocityControl,
+                             const frc::SimpleMotorFeedforward<units::meters>& feedforward,
+                             shared_ptr<ControlData> turnControl) : Chassis(maxSpeed,
+                                                            maxAngSpeed,
+                                                            wheelDiameter,
+                                                            track,
+                                                            velocityControl,
+                                                            feedforward,
+                                                            "SwerveChassisOdometry"),
+                                                    m_driveMotors{frontLeftDrive, frontRightDrive, backLeftDrive, backRightDrive},
+                                                    m_turnMotors{frontLeftTurn, frontRightTurn, backLeftTurn, backRightTurn},
+                                                    m_canCoders{frontLeftCanCoder, frontRightCanCoder, backLeftCanCoder, backRightCanCoder},
+                                                    m_moduleX(),
+                                                    m_moduleY(),
+                                                    m_lastWheelSpeeds(),
+                                                    m_turnOffsets(),
+                                                    m_turnOffsetsSet(false),
+                                                    m_kinematics(),
+                                                    m_swerveOdometry()
+    {
+        // module locations relative to the robot center (x forward, y left)
+        auto halfBase = units::meter_t(wheelBase).to<double>() / 2.0;
+        auto halfTrack = units::meter_t(track).to<double>() / 2.0;
+        m_moduleX = { halfBase,  halfBase, -halfBase, -halfBase};
+        m_moduleY = { halfTrack, -halfTrack, halfTrack, -halfTrack};
+        m_lastWheelSpeeds.fill(0.0);
+        m_turnOffsets.fill(0.0);
+
+        m_kinematics = make_unique<frc::SwerveDriveKinematics<NUM_MODULES>>(
+                                frc::Translation2d(units::meter_t(m_moduleX[FRONT_LEFT]), units::meter_t(m_moduleY[FRONT_LEFT])),
+                                frc::Translation2d(units::meter_t(m_moduleX[FRONT_RIGHT]), units::meter_t(m_moduleY[FRONT_RIGHT])),
+                                frc::Translation2d(units::meter_t(m_moduleX[BACK_LEFT]), units::meter_t(m_moduleY[BACK_LEFT])),
+                                frc::Translation2d(units::meter_t(m_moduleX[BACK_RIGHT]), units::meter_t(m_moduleY[BACK_RIGHT])));
+
+        for (auto motor : m_driveMotors)
+        {
+            InitDriveMotor(motor.get());
+        }
+        for (auto motor : m_turnMotors)
+        {
+            if (motor.get() != nullptr && turnControl.get() != nullptr)
+            {
+                motor.get()->SetControlConstants(0, turnControl.get());
+            }
+        }
+    }
+
+    //The odometry notifier uses the odometry, so stop it first
+    SwerveChassis::~SwerveChassis()
+    {
+        StopOdometry();
+    }
+
+    //Moves the robot
+    void SwerveChassis::Drive(frc::ChassisSpeeds chassisSpeeds)
+    {
+        auto vx = chassisSpeeds.vx.to<double>();
+        auto vy = chassisSpeeds.vy.to<double>();
+        auto omega = chassisSpeeds.omega.to<double>();
+
+        // module speeds and angles for all modules in one pass over the module arrays
+        array<double, NUM_MODULES> speeds;
+        array<double, NUM_MODULES> angles;
+        auto fastest = 0.0;
+        for (size_t i = 0; i < NUM_MODULES; ++i)
+        {
+            auto moduleVx = vx - omega * m_moduleY[i];
+            auto moduleVy = vy + omega * m_moduleX[i];
+            speeds[i] = hypot(moduleVx, moduleVy);
+            angles[i] = atan2(moduleVy, moduleVx);
+            fastest = max(fastest, speeds[i]);
+        }
+
+        // desaturate: scale every module by the same amount so the motion keeps its shape
+        auto maxSpeed = m_maxSpeed.to<double>();
+        auto scale = fastest > maxSpeed && fastest > 0.0 ? maxSpeed / fastest : 1.0;
+        auto stopped = fastest * scale < MOVING_SPEED / 10.0;
+
+        // acceleration from the change in setpoint since the last call; ignore it after a pause
+        auto now = frc::Timer::GetFPGATimestamp();
+        auto dt = now - m_lastDriveTime;
+        auto useAccel = dt > units::second_t(0) && dt < units::second_t(0.1);
+        m_lastDriveTime = now;
+
+        for (size_t i = 0; i < NUM_MODULES; ++i)
+        {
+            auto speed = speeds[i] * scale;
+
+            // turn the shortest way; past 90 degrees, point the other way and drive backwards
+            auto moduleAngle = GetModuleAngle(i);
+            auto target = moduleAngle;
+            if (!stopped)
+            {
+                target = angles[i];
+                if (abs(remainder(target - moduleAngle, 2.0 * wpi::numbers::pi)) > wpi::numbers::pi / 2.0)
+                {
+                    target += wpi::numbers::pi;
+                    speed = -speed;
+                }
+            }
+
+            // command the absolute module angle in turn encoder degrees; the turn encoder counts whole
+            // turns, so pick the turn nearest the encoder (the encoder snapshot being a loop old 
+            // only matters at 180 degrees, and the target is always within 90)
+            auto turnMotor = m_turnMotors[i].get();
+            if (turnMotor != nullptr)
+            {
+                auto turnDegrees = turnMotor->GetRotations() * 360.0;
+                if (!m_turnOffsetsSet)
+                {
+                    m_turnOffsets[i] = turnDegrees - moduleAngle * 180.0 / wpi::numbers::pi;
+                }
+                auto setpoint = m_turnOffsets[i] + target * 180.0 / wpi::numbers::pi;
+                turnMotor->Set(setpoint + 360.0 * round((turnDegrees - setpoint) / 360.0));
+            }
+
+            auto driveMotor = m_driveMotors[i].get();
+            if (m_velocityControl.get() != nullptr)
+            {
+                auto accel = useAccel ? (speed - m_lastWheelSpeeds[i]) / dt.to<double>() : 0.0;
+                SetWheelVelocity(driveMotor, units::meters_per_second_t(speed), units::meters_per_second_squared_t(accel));
+            }
+            else if (driveMotor != nullptr)
+            {
+                driveMotor->Set(speed / maxSpeed);
+            }
+            m_lastWheelSpeeds[i] = speed;
+        }
+        m_turnOffsetsSet = true;
+    }
+
+    void SwerveChassis::DriveFieldOriented(frc::ChassisSpeeds fieldSpeeds)
+    {
+        Drive(frc::ChassisSpeeds::FromFieldRelativeSpeeds(fieldSpeeds.vx, fieldSpeeds.vy, fieldSpeeds.omega, GetHeading()));
+    }
+
+    bool SwerveChassis::IsHolonomic() const
+    {
+        return true;
+    }
+
+    void SwerveChassis::InitOdometry(const frc::Rotation2d& heading, const frc::Pose2d& pose)
+    {
+        auto speed = 0.0;
+        m_swerveOdometry = make_unique<frc::SwerveDriveOdometry<NUM_MODULES>>(*m_kinematics.get(), heading, GetModulePositions(speed), pose);
+    }
+
+    frc::Pose2d SwerveChassis::UpdateOdometry
+    (
+        const frc::Rotation2d&  heading,
+        const frc::Pose2d*      resetPose,
+        double&                 maxWheelSpeed
+    )
+    {
+        auto positions = GetModulePositions(maxWheelSpeed);
+        if (resetPose != nullptr)
+        {
+            m_swerveOdometry.get()->ResetPosition(heading, positions, *resetPose);
+            return *resetPose;
+        }
+        return m_swerveOdometry.get()->Update(heading, positions);
+    }
+
+    array<frc::SwerveModulePosition, SwerveChassis::NUM_MODULES> SwerveChassis::GetModulePositions
+    (
+        double& maxWheelSpeed
+    ) const
+    {
+        array<frc::SwerveModulePosition, NUM_MODULES> positions;
+        maxWheelSpeed = 0.0;
+        for (size_t i = 0; i < NUM_MODULES; ++i)
+        {
+            units::meter_t distance{0};
+            units::meters_per_second_t speed{0};
+            GetWheelTravel(m_driveMotors[i].get(), distance, speed);
+            maxWheelSpeed = max(maxWheelSpeed, abs(speed.to<double>()));
+            positions[i] = frc::SwerveModulePosition{distance, frc::Rotation2d(units::radian_t(GetModuleAngle(i)))};
+        }
+        return positions;
+    }
+
+    double SwerveChassis::GetModuleAngle(size_t module) const
+    {
+        auto canCoder = m_canCoders[module].get();
+        return canCoder != nullptr ? canCoder->GetAbsolutePosition() * wpi::numbers::pi / 180.0 : 0.0;
+    }
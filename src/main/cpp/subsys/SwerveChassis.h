@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include <units/velocity.h>
+#include <units/angular_velocity.h>
+#include <units/acceleration.h>
+#include <units/time.h>
+
+#include <subsys/Chassis.h>
+#include <hw/interfaces/IDragonMotorController.h>
+#include <frc/kinematics/SwerveDriveKinematics.h>
+#include <frc/kinematics/SwerveDriveOdometry.h>
+#include <frc/kinematics/SwerveModulePosition.h>
+#include <frc/controller/SimpleMotorFeedforward.h>
+#include <ctre/phoenix/sensors/CANCoder.h>
+#include <controllers/ControlData.h>
+
+/// @class SwerveChassis
+/// @brief Four module swerve drive.  Each module has a drive motor, a turn motor and a CANCoder that
+///        reads the absolute module angle (zero is pointing forward; the zero offset is the magnet
+///        offset stored on the CANCoder).  Module states are computed together over per module arrays.
+class SwerveChassis : public Chassis {
+
+    public:
+        SwerveChassis() = delete;
+        virtual ~SwerveChassis();
+
+        SwerveChassis(std::shared_ptr<IDragonMotorController> frontLeftDrive,
+                      std::shared_ptr<IDragonMotorController> frontLeftTurn,
+                      std::shared_ptr<ctre::phoenix::sensors::CANCoder> frontLeftCanCoder,
+                      std::shared_ptr<IDragonMotorController> frontRightDrive,
+                      std::shared_ptr<IDragonMotorController> frontRightTurn,
+                      std::shared_ptr<ctre::phoenix::sensors::CANCoder> frontRightCanCoder,
+                      std::shared_ptr<IDragonMotorController> backLeftDrive,
+                      std::shared_ptr<IDragonMotorController> backLeftTurn,
+                      std::shared_ptr<ctre::phoenix::sensors::CANCoder> backLeftCanCoder,
+                      std::shared_ptr<IDragonMotorController> backRightDrive,
+                      std::shared_ptr<IDragonMotorController> backRightTurn,
+                      std::shared_ptr<ctre::phoenix::sensors::CANCoder> backRightCanCoder,
+                      units::length::inch_t wheelBase,
+                      units::length::inch_t track,
+                      units::velocity::meters_per_second_t maxSpeed,
+                      units::angular_velocity::degrees_per_second_t maxAngSpeed,
+                      units::length::inch_t wheelDiameter,
+                      std::shared_ptr<ControlData> velocityControl,
+                      const frc::SimpleMotorFeedforward<units::meters>& feedforward,
+                      std::shared_ptr<ControlData> turnControl);
+
+        void Drive(frc::ChassisSpeeds chassisSpeeds) override;
+        void DriveFieldOriented(frc::ChassisSpeeds fieldSpeeds) override;
+        bool IsHolonomic() const override;
+
+    protected:
+        void InitOdometry(const frc::Rotation2d& heading, const frc::Pose2d& pose) override;
+        frc::Pose2d UpdateOdometry(const frc::Rotation2d& heading, const frc::Pose2d* resetPose, double& maxWheelSpeed) override;
+
+    private:
+        enum MODULE
+        {
+            FRONT_LEFT,
+            FRONT_RIGHT,
+            BACK_LEFT,
+            BACK_RIGHT,
+            NUM_MODULES
+        };
+
+        /// @brief distance and angle of every module, plus the fastest wheel speed (meters per second)
+        std::array<frc::SwerveModulePosition, NUM_MODULES> GetModulePositions(double& maxWheelSpeed) const;
+
+        /// @brief absolute module angle from the CANCoder (radians, zero is forward)
+        double GetModuleAngle(size_t module) const;
+
+        std::array<std::shared_ptr<IDragonMotorController>, NUM_MODULES>            m_driveMotors;
+        std::array<std::shared_ptr<IDragonMotorController>, NUM_MODULES>            m_turnMotors;
+        std::array<std::shared_ptr<ctre::phoenix::sensors::CANCoder>, NUM_MODULES>  m_canCoders;
+        std::array<double, NUM_MODULES>     m_moduleX;              // meters forward of the robot center
+        std::array<double, NUM_MODULES>     m_moduleY;              // meters left of the robot center
+        std::array<double, NUM_MODULES>     m_lastWheelSpeeds;      // last drive setpoints (for acceleration)
+        std::array<double, NUM_MODULES>     m_turnOffsets;          // turn encoder degrees at module angle zero
+        bool                                m_turnOffsetsSet;       // offsets are taken on the first drive, before the modules turn
+
+        std::unique_ptr<frc::SwerveDriveKinematics<NUM_MODULES>>    m_kinematics;
+        std::unique_ptr<frc::SwerveDriveOdometry<NUM_MODULES>>      m_swerveOdometry;   // only used on the odometry thread
+
+
+};
@@ -0,0 +1,202 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// VisionPoseEstimator.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Latency compensated fusion of chassis odometry and limelight measurements.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cmath>
+#include <string>
+
+// FRC includes
+#include <frc/geometry/Transform2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/Timer.h>
+
+// Team 302 includes
+#include <hw/DragonLimelight.h>
+#include <hw/factories/LimelightFactory.h>
+#include <subsys/ChassisFactory.h>
+#include <subsys/interfaces/IChassis.h>
+#include <subsys/VisionPoseEstimator.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+using namespace frc;
+
+VisionPoseEstimator* VisionPoseEstimator::m_instance = nullptr;
+VisionPoseEstimator* VisionPoseEstimator::GetInstance()
+{
+    if ( VisionPoseEstimator::m_instance == nullptr )
+    {
+        VisionPoseEstimator::m_instance = new VisionPoseEstimator( ChassisFactory::GetChassisFactory()->GetIChassis(),
+                                                                   LimelightFactory::GetLimelightFactory()->GetLimelight( IDragonSensor::SENSOR_USAGE::MAIN_LIMELIGHT ) );
+    }
+    return VisionPoseEstimator::m_instance;
+}
+
+VisionPoseEstimator::VisionPoseEstimator
+(
+    IChassis*           chassis,
+    DragonLimelight*    limelight
+) : m_chassis( chassis ),
+    m_limelight( limelight ),
+    m_origin(),
+    m_targetPose(),
+    m_hasTargetPose( false ),
+    m_lastFrame( units::second_t(0.0) ),
+    m_history(),
+    m_ntXHandle( Logger::INVALID_NT_HANDLE ),
+    m_ntYHandle( Logger::INVALID_NT_HANDLE ),
+    m_ntHeadingHandle( Logger::INVALID_NT_HANDLE ),
+    m_ntMeasurementsHandle( Logger::INVALID_NT_HANDLE ),
+    m_measurements( 0.0 )
+{
+    auto logger = Logger::GetLogger();
+    auto ntName = string("VisionPoseEstimator");
+    m_ntXHandle            = logger->RegisterNtEntry( ntName, string("x (m)") );
+    m_ntYHandle            = logger->RegisterNtEntry( ntName, string("y (m)") );
+    m_ntHeadingHandle      = logger->RegisterNtEntry( ntName, string("heading (deg)") );
+    m_ntMeasurementsHandle = logger->RegisterNtEntry( ntName, string("vision measurements") );
+}
+
+void VisionPoseEstimator::Update()
+{
+    if ( m_chassis == nullptr )
+    {
+        return;
+    }
+
+    auto now = Timer::GetFPGATimestamp();
+    m_history.Add( now, m_chassis->GetPose() );
+
+    // a frame stays published for several loops; only apply it the first time it is seen
+    auto frame = ( m_limelight != nullptr ) ? m_limelight->GetFrameTimestamp() : m_lastFrame;
+    if ( frame != m_lastFrame && m_hasTargetPose && m_limelight->HasTarget() )
+    {
+        m_lastFrame = frame;
+        auto capture = frame - units::second_t( m_limelight->GetPipelineLatency() ) - CAPTURE_LATENCY;
+        Pose2d odometryAtCapture;
+        if ( m_history.Sample( capture, odometryAtCapture ) )
+        {
+            Pose2d measurement;
+            if ( CalcVisionPose( ToField( odometryAtCapture ).Rotation(), measurement ) )
+            {
+                AddVisionMeasurement( measurement, capture );
+            }
+        }
+    }
+
+    auto pose = GetEstimatedPose();
+    auto logger = Logger::GetLogger();
+    logger->ToNtTable( m_ntXHandle, pose.X().to<double>() );
+    logger->ToNtTable( m_ntYHandle, pose.Y().to<double>() );
+    logger->ToNtTable( m_ntHeadingHandle, pose.Rotation().Degrees().to<double>() );
+    logger->ToNtTable( m_ntMeasurementsHandle, m_measurements );
+}
+
+Pose2d VisionPoseEstimator::GetEstimatedPose() const
+{
+    return ( m_chassis != nullptr ) ? ToField( m_chassis->GetPose() ) : m_origin;
+}
+
+void VisionPoseEstimator::ResetPose
+(
+    const Pose2d&   pose
+)
+{
+    // the chassis odometry is moved to the pose, so the history from before the reset no longer
+    // lines up with it
+    if ( m_chassis != nullptr )
+    {
+        m_chassis->ResetPose( pose );
+        m_origin = Pose2d();
+    }
+    else
+    {
+        m_origin = pose;
+    }
+    m_history.Clear();
+}
+
+void VisionPoseEstimator::SetTargetPose
+(
+    const Pose2d&   targetPose
+)
+{
+    m_targetPose = targetPose;
+    m_hasTargetPose = true;
+}
+
+bool VisionPoseEstimator::AddVisionMeasurement
+(
+    const Pose2d&       measurement,
+    units::second_t     timestamp
+)
+{
+    Pose2d odometryAtCapture;
+    if ( !m_history.Sample( timestamp, odometryAtCapture ) )
+    {
+        return false;
+    }
+
+    // correct the estimate where the robot was when the image was taken, then move the origin 
+    // so that pose lines up with the odometry from that time; the odometry since then is 
+    // replayed on top of the correction
+    auto estimate = ToField( odometryAtCapture );
+    auto corrected = Pose2d( estimate.Translation() + ( measurement.Translation() - estimate.Translation() ) * VISION_WEIGHT, 
+                             estimate.Rotation() );
+    m_origin = corrected.TransformBy( Transform2d( odometryAtCapture, Pose2d() ) );
+    m_measurements++;
+    return true;
+}
+
+bool VisionPoseEstimator::CalcVisionPose
+(
+    const Rotation2d&   heading,
+    Pose2d&             pose
+) const
+{
+    units::meter_t distance = m_limelight->EstimateTargetDistance();
+    if ( !isfinite( distance.to<double>() ) || distance <= units::meter_t(0.0) )
+    {
+        return false;
+    }
+
+    // tx is positive when the target is to the right (clockwise)
+    auto bearing = heading - Rotation2d( m_limelight->GetTargetHorizontalOffset() );
+    auto camera = m_targetPose.Translation() - Translation2d( distance, bearing );
+    auto mountOffset = Translation2d( units::meter_t(0.0), units::meter_t( m_limelight->GetMountingHorizontalOffset() ) ).RotateBy( heading );
+    pose = Pose2d( camera - mountOffset, heading );
+    return true;
+}
+
+Pose2d VisionPoseEstimator::ToField
+(
+    const Pose2d&   odometryPose
+) const
+{
+    return m_origin.TransformBy( Transform2d( Pose2d(), odometryPose ) );
+}
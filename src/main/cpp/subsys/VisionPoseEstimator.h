@@ -0,0 +1,130 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// VisionPoseEstimator.h
+//========================================================================================================
+///
+/// File Description:
+///     Combines the chassis odometry with limelight measurements of a vision target at a known spot
+///     on the field.  Every loop the odometry pose is recorded in a fixed size history.  A limelight
+///     measurement is compared with where odometry says the robot was when the image was captured 
+///     (now - pipeline latency - capture latency), not where it is now, and the correction is 
+///     carried forward by the odometry recorded since then.
+///
+///     The estimate is kept as odometry pose relative to a field origin; a measurement moves the 
+///     origin, so everything odometry integrated after the capture time is replayed on top of the
+///     corrected pose.  Each limelight frame is applied once, however many loops it stays published.
+///
+///     DrivePath follows the estimated pose, and ResetPosition resets the chassis through it.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <utils/PoseHistory.h>
+
+// Third Party Includes
+
+class DragonLimelight;
+class IChassis;
+
+class VisionPoseEstimator
+{
+    public:
+        /// @brief get the estimator for the chassis and main limelight; the robot must be built first
+        static VisionPoseEstimator* GetInstance();
+
+        /// @brief record the odometry pose and apply a new limelight measurement if there is one;
+        ///        call once per loop after the chassis pose is updated
+        void Update();
+
+        /// @brief odometry corrected by the vision measurements
+        /// @returns frc::Pose2d estimated field pose
+        frc::Pose2d GetEstimatedPose() const;
+
+        /// @brief set the estimated pose and the chassis odometry (e.g. the starting pose of an auton)
+        /// @param [in] const frc::Pose2d& pose - field pose of the robot
+        void ResetPose
+        (
+            const frc::Pose2d&  pose
+        );
+
+        /// @brief where the vision target is on the field; measurements are ignored until this is set
+        /// @param [in] const frc::Pose2d& targetPose - field pose of the vision target
+        void SetTargetPose
+        (
+            const frc::Pose2d&  targetPose
+        );
+
+        /// @brief blend a field pose measured at an earlier time into the estimate
+        /// @param [in] const frc::Pose2d& measurement - measured field pose (only the position is used)
+        /// @param [in] units::second_t timestamp - FPGA time the measurement was captured
+        /// @returns bool false if the timestamp is older than the pose history
+        bool AddVisionMeasurement
+        (
+            const frc::Pose2d&  measurement,
+            units::second_t     timestamp
+        );
+
+        static constexpr double             VISION_WEIGHT = 0.2;                        // fraction of the error removed per measurement
+        static constexpr units::second_t    CAPTURE_LATENCY = units::second_t(0.011);   // image capture time not included in tl
+
+    private:
+        VisionPoseEstimator() = delete;
+        VisionPoseEstimator
+        (
+            IChassis*           chassis,    // chassis whose odometry is corrected
+            DragonLimelight*    limelight   // camera (may be nullptr for odometry only)
+        );
+        ~VisionPoseEstimator() = default;
+
+        static VisionPoseEstimator*     m_instance;
+
+        /// @brief robot field pose from the limelight target at the given heading
+        bool CalcVisionPose
+        (
+            const frc::Rotation2d&  heading,
+            frc::Pose2d&            pose
+        ) const;
+
+        frc::Pose2d ToField
+        (
+            const frc::Pose2d&  odometryPose
+        ) const;
+
+        IChassis*                       m_chassis;
+        DragonLimelight*                m_limelight;
+        frc::Pose2d                     m_origin;           // field pose of the odometry origin
+        frc::Pose2d                     m_targetPose;
+        bool                            m_hasTargetPose;
+        units::second_t                 m_lastFrame;        // publish time of the last frame applied
+        PoseHistory<50>                 m_history;          // one second of loops
+
+        int                             m_ntXHandle;
+        int                             m_ntYHandle;
+        int                             m_ntHeadingHandle;
+        int                             m_ntMeasurementsHandle;
+        double                          m_measurements;
+};
@@ -49,6 +49,18 @@ class IChassis
             frc::ChassisSpeeds chassisSpeeds
         ) = 0;
 
+        /// @brief      Run chassis with speeds relative to the field (vx is away from the driver 
+        ///             station, vy is to the left, heading from the pigeon)
+        /// @return     void
+        virtual void DriveFieldOriented
+        (
+            frc::ChassisSpeeds fieldSpeeds
+        ) = 0;
+
+        /// @brief      Can the chassis strafe (vy) as well as drive and rotate
+        /// @return     bool - true for holonomic (swerve, mecanum) chassis
+        virtual bool IsHolonomic() const = 0;
+
 
         virtual frc::Pose2d GetPose() const = 0;
         virtual void ResetPose
@@ -0,0 +1,103 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DoubleBuffer.h
+//========================================================================================================
+///
+/// File Description:
+///     Lock-free, single writer / many reader latest value.  The writer fills the buffer the readers
+///     aren't looking at and then flips the index, so readers never wait on a write in progress.  
+///     Each buffer has a sequence number; a reader that gets lapped (the writer wrapped back onto 
+///     the buffer being copied) just copies again.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+template <typename T>
+class DoubleBuffer
+{
+    static_assert( std::is_trivially_copyable<T>::value, "DoubleBuffer T must be trivially copyable" );
+
+    public:
+        DoubleBuffer() : DoubleBuffer( T() )
+        {
+        }
+
+        explicit DoubleBuffer
+        (
+            const T&    initial
+        ) : m_buffer{ { initial, initial } },
+            m_sequence{ { 0, 0 } },
+            m_index( 0 )
+        {
+        }
+        ~DoubleBuffer() = default;
+
+        /// @brief publish a new value (writer thread only)
+        /// @param [in] const T& value - value to copy into the buffer
+        void Write
+        (
+            const T&    value
+        )
+        {
+            auto next = 1U - m_index.load( std::memory_order_relaxed );
+            m_sequence[next].fetch_add( 1, std::memory_order_relaxed );    // odd: being written
+            std::atomic_thread_fence( std::memory_order_release );
+            m_buffer[next] = value;
+            m_sequence[next].fetch_add( 1, std::memory_order_release );    // even: complete
+            m_index.store( next, std::memory_order_release );
+        }
+
+        /// @brief get the last value written (any thread, never blocks on the writer)
+        /// @returns T copy of the latest value
+        T Read() const
+        {
+            while ( true )
+            {
+                auto index  = m_index.load( std::memory_order_acquire );
+                auto before = m_sequence[index].load( std::memory_order_acquire );
+                if ( ( before & 1U ) == 0 )
+                {
+                    T value = m_buffer[index];
+                    std::atomic_thread_fence( std::memory_order_acquire );
+                    if ( m_sequence[index].load( std::memory_order_relaxed ) == before )
+                    {
+                        return value;
+                    }
+                }
+            }
+        }
+
+    private:
+        std::array<T, 2>                        m_buffer;
+        std::array<std::atomic<uint32_t>, 2>    m_sequence;
+        std::atomic<uint32_t>                   m_index;
+};
@@ -19,25 +19,38 @@
 //========================================================================================================
 ///
 /// File Description:
-///     This logs error messages
+///     This logs error messages.  Messages and network table values are queued into a fixed size
+///     ring buffer by the robot loop and written out (console, SmartDashboard, network tables) by a 
+///     low priority background thread, so logging doesn't add I/O time to the robot loop.  Other 
+///     threads (parallel hardware setup, auton parsing, path generation) may log too; they share a 
+///     second queue behind a mutex so the robot loop's queue stays single producer and lock free.
 ///
 //========================================================================================================
 
 
 // C++ Includes
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 #include <locale>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 
 // FRC includes
 #include <frc/SmartDashboard/SmartDashboard.h>
+#include <frc/RobotController.h>
+#include <frc/Threads.h>
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
 
 // Team 302 includes
 #include <utils/Logger.h>
+#include <utils/MatchLog.h>
+#include <utils/MatchLogFormat.h>
 
 
 // Third Party Includes
@@ -45,6 +58,28 @@
 using namespace frc;
 using namespace std;
 
+namespace
+{
+    const string MATCH_LOG_DIRECTORY = string("/home/lvuser/logs");
+    constexpr uint64_t MATCH_LOG_RECORDS = 1 << 20;    // 32 MB, ~6 minutes of 100 values every loop
+
+    /// @brief FNV-1a hash of the strings as if they were joined with separator
+    uint64_t HashKey
+    (
+        string_view     first,
+        char            separator,
+        string_view     second
+    )
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        auto add = [&hash]( char c ) { hash = ( hash ^ static_cast<uint8_t>(c) ) * 1099511628211ULL; };
+        for_each( first.begin(), first.end(), add );
+        add( separator );
+        for_each( second.begin(), second.end(), add );
+        return hash;
+    }
+}
+
 
 /// @brief Find or create the singleton logger
 /// @returns Logger* pointer to the logger
@@ -65,9 +100,48 @@ void Logger::SetLoggingOption
     LOGGER_OPTION option    
 )
 {
+    if ( option == LOGGER_OPTION::FILE && !OpenMatchLog() )
+    {
+        return;
+    }
     m_option = option;
 }
 
+/// @brief start a new match log if the FILE option is set and the last one was ended
+void Logger::StartMatchLog()
+{
+    if ( m_option == LOGGER_OPTION::FILE )
+    {
+        OpenMatchLog();
+    }
+}
+
+/// @brief end the match log; the publisher closes (and trims) it after writing what is queued
+void Logger::EndMatchLog()
+{
+    m_closeMatchLog.store( true );
+}
+
+/// @brief open a match log unless one is open; an end that the publisher hasn't acted on yet is 
+///        cancelled, so the open log keeps being written
+/// @returns bool true if a match log is open
+bool Logger::OpenMatchLog()
+{
+    lock_guard<mutex> lock( m_matchLogMutex );
+    m_closeMatchLog.store( false );
+    if ( !m_matchLogOpen.load() )
+    {
+        // the publisher thread only touches the match log after m_matchLogOpen is set
+        if ( !m_matchLog.Open( MATCH_LOG_DIRECTORY, MATCH_LOG_RECORDS, RobotController::GetFPGATime() ) )
+        {
+            LogError( LOGGER_LEVEL::ERROR, string("Logger::OpenMatchLog"), string("unable to create match log in ") + MATCH_LOG_DIRECTORY );
+            return false;
+        }
+        m_matchLogOpen.store( true );
+    }
+    return true;
+}
+
 /// @brief set the level for messages that will be displayed
 /// @param [in] LOGGER_LEVEL:  logging level for which messages to display
 void Logger::SetLoggingLevel
@@ -103,28 +177,21 @@ void Logger::LogError
 {
     if ( level <= m_level )
     {
-        auto display = true;
-        if ( level%2 == 1 )
-        {
-            string key = locationIdentifier + message;
-            auto it = m_alreadyDisplayed.find(key);
-            display = it == m_alreadyDisplayed.end();
-            if (display)
-            {
-                m_alreadyDisplayed.insert(key);
-            }
-
-        }
+        auto display = ( level%2 == 0 ) || FirstTimeDisplayed( locationIdentifier, message );
         if (display)
         {
             switch ( m_option )
             {
                 case LOGGER_OPTION::CONSOLE:
-                    cout << locationIdentifier << ": " << message << endl;
+                    QueueRecord( LogRecord::CONSOLE_MSG, INVALID_NT_HANDLE, 0.0, false, locationIdentifier, message );
                     break;
 
                 case LOGGER_OPTION::DASHBOARD:
-                    SmartDashboard::PutString( locationIdentifier.c_str(), message.c_str());
+                    QueueRecord( LogRecord::DASHBOARD_MSG, INVALID_NT_HANDLE, 0.0, false, locationIdentifier, message );
+                    break;
+
+                case LOGGER_OPTION::FILE:
+                    QueueRecord( LogRecord::FILE_MSG, INVALID_NT_HANDLE, 0.0, false, locationIdentifier, message );
                     break;
 
                 default:  // case LOGGER_OPTION::EAT_IT:
@@ -144,9 +211,13 @@ void Logger::OnDash
     const string&   message                 // <I> - error message
 )
 {
-    if (m_option != Logger::LOGGER_OPTION::EAT_IT)
+    if (m_option == Logger::LOGGER_OPTION::FILE)
+    {
+        QueueRecord( LogRecord::FILE_MSG, INVALID_NT_HANDLE, 0.0, false, locationIdentifier, message );
+    }
+    else if (m_option != Logger::LOGGER_OPTION::EAT_IT)
     {
-        SmartDashboard::PutString( locationIdentifier.c_str(), message.c_str());
+        QueueRecord( LogRecord::DASHBOARD_MSG, INVALID_NT_HANDLE, 0.0, false, locationIdentifier, message );
     }
 }
 
@@ -159,9 +230,13 @@ void Logger::OnDash
     bool            val                 // <I> - error message
 )
 {
-    if (m_option != Logger::LOGGER_OPTION::EAT_IT)
+    if (m_option == Logger::LOGGER_OPTION::FILE)
     {
-        SmartDashboard::PutBoolean( locationIdentifier.c_str(), val );
+        QueueRecord( LogRecord::FILE_MSG, INVALID_NT_HANDLE, 0.0, false, locationIdentifier, val ? string("true") : string("false") );
+    }
+    else if (m_option != Logger::LOGGER_OPTION::EAT_IT)
+    {
+        QueueRecord( LogRecord::DASHBOARD_BOOL, INVALID_NT_HANDLE, 0.0, val, locationIdentifier, string() );
     }
 }
 
@@ -174,8 +249,7 @@ void Logger::ToNtTable
 {
     if (m_option != Logger::LOGGER_OPTION::EAT_IT)
     {
-        auto table = nt::NetworkTableInstance::GetDefault().GetTable(ntName);
-    	table.get()->PutString(identifier, msg);
+        ToNtTable( FindOrRegisterNtEntry(ntName, identifier), msg );
     }
 }
 
@@ -188,8 +262,7 @@ void Logger::ToNtTable
 {
     if (m_option != Logger::LOGGER_OPTION::EAT_IT)
     {   
-        auto table = nt::NetworkTableInstance::GetDefault().GetTable(ntName);
-	    table.get()->PutNumber(identifier, value);
+        ToNtTable( FindOrRegisterNtEntry(ntName, identifier), value );
     }
 }
 
@@ -200,9 +273,9 @@ void Logger::ToNtTable
     const std::string&                  msg 
 )
 {
-    if (m_option != Logger::LOGGER_OPTION::EAT_IT)
+    if (m_option != Logger::LOGGER_OPTION::EAT_IT && ntable.get() != nullptr)
     {
-	    ntable.get()->PutString(identifier, msg);
+        ToNtTable( FindOrRegisterNtEntry(ntable.get()->GetPath(), identifier), msg );
     }
 }
 
@@ -213,14 +286,384 @@ void Logger::ToNtTable
     double                              value 
 )
 {
-    if (m_option != Logger::LOGGER_OPTION::EAT_IT)
+    if (m_option != Logger::LOGGER_OPTION::EAT_IT && ntable.get() != nullptr)
+    {
+        ToNtTable( FindOrRegisterNtEntry(ntable.get()->GetPath(), identifier), value );
+    }
+}
+
+/// @brief Resolve a network table entry once and get a handle that can be used to write 
+///        to it every loop without any table or key lookups.
+/// @param [in] std::string: network table name
+/// @param [in] std::string: entry identifier within the table
+/// @returns int handle to pass into ToNtTable
+int Logger::RegisterNtEntry
+(
+    const std::string&  ntName,
+    const std::string&  identifier
+)
+{
+    return FindOrRegisterNtEntry( ntName, identifier );
+}
+
+int Logger::FindOrRegisterNtEntry
+(
+    string_view         ntName,
+    string_view         identifier
+)
+{
+    // GetPath() returns the full path (leading "/") while GetTable() takes either form, so 
+    // strip it to have both styles of caller share the same entry
+    if ( !ntName.empty() && ntName[0] == '/' )
+    {
+        ntName.remove_prefix( 1 );
+    }
+
+    size_t freeSlot = 0;
+    auto handle = FindNtEntry( ntName, identifier, freeSlot );
+    if ( handle != INVALID_NT_HANDLE )
+    {
+        return handle;
+    }
+
+    // new entry; check again once registration is serialized since another thread may have added it
+    unique_lock<mutex> lock( m_registerMutex );
+    handle = FindNtEntry( ntName, identifier, freeSlot );
+    if ( handle != INVALID_NT_HANDLE )
+    {
+        return handle;
+    }
+
+    if ( m_ntEntryCount >= MAX_NT_ENTRIES )
+    {
+        lock.unlock();
+        LogError( LOGGER_LEVEL::ERROR_ONCE, string("Logger::RegisterNtEntry"), string("too many network table entries") );
+        return INVALID_NT_HANDLE;
+    }
+
+    handle = m_ntEntryCount.load();
+    m_ntEntries[handle] = nt::NetworkTableInstance::GetDefault().GetTable(ntName)->GetEntry(identifier);
+    m_ntNames[handle]   = string(ntName) + "/" + string(identifier);
+    m_ntEntryCount.store( handle + 1 );
+    m_ntIndex[freeSlot].store( handle, memory_order_release );     // publish after the entry is filled in
+    return handle;
+}
+
+int Logger::FindNtEntry
+(
+    string_view         ntName,
+    string_view         identifier,
+    size_t&             freeSlot
+) const
+{
+    auto mask = m_ntIndex.size() - 1;
+    auto slot = HashKey( ntName, '/', identifier ) & mask;
+    for ( size_t probe=0; probe<m_ntIndex.size(); ++probe, slot = (slot + 1) & mask )
+    {
+        auto handle = m_ntIndex[slot].load( memory_order_acquire );
+        if ( handle == INVALID_NT_HANDLE )
+        {
+            freeSlot = slot;
+            return INVALID_NT_HANDLE;
+        }
+
+        // names are stored as table/identifier
+        string_view name( m_ntNames[handle] );
+        if ( name.size() == ntName.size() + 1 + identifier.size() &&
+             name.compare( 0, ntName.size(), ntName ) == 0 &&
+             name.compare( ntName.size() + 1, identifier.size(), identifier ) == 0 )
+        {
+            return handle;
+        }
+    }
+    return INVALID_NT_HANDLE;   // can't happen: the index has twice as many slots as entries
+}
+
+bool Logger::FirstTimeDisplayed
+(
+    const string&   locationIdentifier,
+    const string&   message
+)
+{
+    auto hash = HashKey( locationIdentifier, ':', message );
+    hash = ( hash == 0 ) ? 1 : hash;    // 0 marks an empty slot
+
+    auto mask = m_displayedOnce.size() - 1;
+    auto slot = hash & mask;
+    for ( size_t probe=0; probe<m_displayedOnce.size(); ++probe, slot = (slot + 1) & mask )
+    {
+        uint64_t seen = 0;
+        if ( m_displayedOnce[slot].compare_exchange_strong( seen, hash ) )
+        {
+            return true;
+        }
+        if ( seen == hash )
+        {
+            return false;
+        }
+    }
+    return true;    // more distinct messages than slots; show it rather than lose it
+}
+
+/// @brief Write a value to a registered network table entry
+/// @param [in] int: handle returned from RegisterNtEntry
+/// @param [in] double: value to write
+void Logger::ToNtTable
+(
+    int                 handle,
+    double              value
+)
+{
+    if ( m_option != Logger::LOGGER_OPTION::EAT_IT && handle >= 0 && handle < m_ntEntryCount )
     {
-	    ntable.get()->PutNumber(identifier, value);
+        QueueRecord( m_option == LOGGER_OPTION::FILE ? LogRecord::FILE_DOUBLE : LogRecord::NT_DOUBLE, handle, value, false, string(), string() );
+    }
+}
+
+/// @brief Write a message to a registered network table entry
+/// @param [in] int: handle returned from RegisterNtEntry
+/// @param [in] std::string: message to write
+void Logger::ToNtTable
+(
+    int                 handle,
+    const std::string&  msg
+)
+{
+    if ( m_option != Logger::LOGGER_OPTION::EAT_IT && handle >= 0 && handle < m_ntEntryCount )
+    {
+        QueueRecord( m_option == LOGGER_OPTION::FILE ? LogRecord::FILE_STRING : LogRecord::NT_STRING, handle, 0.0, false, string(), msg );
+    }
+}
+
+/// @brief number of log records that were thrown away because the queue was full
+/// @returns uint64_t dropped record count
+uint64_t Logger::GetDroppedCount() const
+{
+    return m_queue.GetDroppedCount() + m_workerQueue.GetDroppedCount();
+}
+
+/// @brief largest number of log records that have been waiting to be written at once
+/// @returns uint64_t queue high water mark
+uint64_t Logger::GetQueueHighWaterMark() const
+{
+    return max( m_queue.GetHighWaterMark(), m_workerQueue.GetHighWaterMark() );
+}
+
+/// @brief copy the item into the next free queue slot.  Strings longer than the record holds are 
+///        truncated.  If the queue is full the record is dropped (and counted) rather than blocking.
+void Logger::QueueRecord
+(
+    LogRecord::RECORD_TYPE  type,
+    int                     handle,
+    double                  value,
+    bool                    flag,
+    const std::string&      location,
+    const std::string&      message
+)
+{
+    // the robot loop never takes a lock; the other threads serialize on the worker queue
+    auto queue = &m_queue;
+    unique_lock<mutex> lock( m_workerMutex, defer_lock );
+    if ( this_thread::get_id() != m_loopThread )
+    {
+        lock.lock();
+        queue = &m_workerQueue;
+    }
+
+    auto record = queue->Reserve();
+    if ( record != nullptr )
+    {
+        record->type   = type;
+        record->flag   = flag;
+        record->handle = handle;
+        record->value  = value;
+        record->timestamp = ( type >= LogRecord::FILE_MSG ) ? RobotController::GetFPGATime() : 0;
+
+        auto len = min( location.size(), sizeof(record->location) - 1 );
+        memcpy( record->location, location.data(), len );
+        record->location[len] = '\0';
+
+        len = min( message.size(), sizeof(record->message) - 1 );
+        memcpy( record->message, message.data(), len );
+        record->message[len] = '\0';
+
+        queue->Commit();
+    }
+}
+
+/// @brief drain the queue and do the actual writes; runs on the non real-time publisher thread
+void Logger::PublishThread()
+{
+    frc::SetCurrentThreadPriority( false, 0 );
+
+    uint64_t lastDropped   = 0;
+    uint64_t lastHighWater = 0;
+    auto     loops         = 0;
+    LogRecord record;
+    while ( m_running.load() )
+    {
+        while ( m_queue.TryPop( record ) )
+        {
+            Publish( record );
+        }
+        while ( m_workerQueue.TryPop( record ) )
+        {
+            Publish( record );
+        }
+
+        if ( m_closeMatchLog.load() )
+        {
+            lock_guard<mutex> lock( m_matchLogMutex );
+            if ( m_closeMatchLog.load() && m_matchLogOpen.load() )
+            {
+                m_matchLogOpen.store( false );
+                m_matchLog.Close();
+                m_channelNamed.fill( false );   // the next log names its channels again
+            }
+            m_closeMatchLog.store( false );
+        }
+
+        // kick off write back about once a second rather than per record
+        if ( ++loops >= 100 )
+        {
+            loops = 0;
+            if ( m_matchLogOpen.load() )
+            {
+                m_matchLog.Flush();
+            }
+        }
+
+        auto dropped = GetDroppedCount();
+        if ( dropped != lastDropped )
+        {
+            m_ntEntries[m_droppedHandle].SetDouble( static_cast<double>(dropped) );
+            lastDropped = dropped;
+        }
+        auto highWater = GetQueueHighWaterMark();
+        if ( highWater != lastHighWater )
+        {
+            m_ntEntries[m_highWaterHandle].SetDouble( static_cast<double>(highWater) );
+            lastHighWater = highWater;
+        }
+
+        this_thread::sleep_for( chrono::milliseconds(10) );
+    }
+}
+
+/// @brief write a single record to its destination
+void Logger::Publish
+(
+    const LogRecord&        record
+)
+{
+    switch ( record.type )
+    {
+        case LogRecord::CONSOLE_MSG:
+            cout << record.location << ": " << record.message << endl;
+            break;
+
+        case LogRecord::DASHBOARD_MSG:
+            SmartDashboard::PutString( record.location, record.message );
+            break;
+
+        case LogRecord::DASHBOARD_BOOL:
+            SmartDashboard::PutBoolean( record.location, record.flag );
+            break;
+
+        case LogRecord::NT_DOUBLE:
+            m_ntEntries[record.handle].SetDouble( record.value );
+            break;
+
+        case LogRecord::NT_STRING:
+            m_ntEntries[record.handle].SetString( record.message );
+            break;
+
+        case LogRecord::FILE_MSG:
+        {
+            if ( !m_matchLogOpen.load() )
+            {
+                break;
+            }
+            string text( record.location );
+            text += ": ";
+            text += record.message;
+            m_matchLog.WriteString( record.timestamp, MatchLogFormat::MESSAGE_CHANNEL, text );
+            break;
+        }
+
+        case LogRecord::FILE_DOUBLE:
+        case LogRecord::FILE_STRING:
+        {
+            if ( !m_matchLogOpen.load() )
+            {
+                break;
+            }
+            auto channel = static_cast<uint16_t>( record.handle + 1 );
+            if ( !m_channelNamed[record.handle] )
+            {
+                m_matchLog.WriteChannelName( record.timestamp, channel, m_ntNames[record.handle] );
+                m_channelNamed[record.handle] = true;
+            }
+            if ( record.type == LogRecord::FILE_DOUBLE )
+            {
+                m_matchLog.WriteDouble( record.timestamp, channel, record.value );
+            }
+            else
+            {
+                m_matchLog.WriteString( record.timestamp, channel, record.message );
+            }
+            break;
+        }
+
+        default:
+            break;
     }
 }
 
 Logger::Logger() : m_option( LOGGER_OPTION::EAT_IT ), 
                    m_level( LOGGER_LEVEL::PRINT ),
-                   m_alreadyDisplayed()
+                   m_displayedOnce(),
+                   m_ntEntries(),
+                   m_ntNames(),
+                   m_ntEntryCount( 0 ),
+                   m_ntIndex(),
+                   m_registerMutex(),
+                   m_loopThread( this_thread::get_id() ),
+                   m_queue(),
+                   m_workerMutex(),
+                   m_workerQueue(),
+                   m_running( true ),
+                   m_droppedHandle( INVALID_NT_HANDLE ),
+                   m_highWaterHandle( INVALID_NT_HANDLE ),
+                   m_matchLog(),
+                   m_matchLogOpen( false ),
+                   m_closeMatchLog( false ),
+                   m_matchLogMutex(),
+                   m_channelNamed(),
+                   m_publisher()
 {
+    for ( auto& slot : m_displayedOnce )
+    {
+        slot.store( 0 );
+    }
+    for ( auto& slot : m_ntIndex )
+    {
+        slot.store( INVALID_NT_HANDLE );
+    }
+
+    // register before the publisher starts since it writes these directly
+    m_droppedHandle   = RegisterNtEntry( string("Logger"), string("Dropped Records") );
+    m_highWaterHandle = RegisterNtEntry( string("Logger"), string("Queue High Water") );
+
+    m_publisher = thread( &Logger::PublishThread, this );
+}
+
+Logger::~Logger()
+{
+    m_running.store( false );
+    if ( m_publisher.joinable() )
+    {
+        m_publisher.join();
+    }
+    m_matchLog.Close();
 }
@@ -19,15 +19,25 @@
 //========================================================================================================
 ///
 /// File Description:
-///     This logs error messages
+///     This logs error messages.  Messages and network table values are queued into a fixed size
+///     ring buffer by the robot loop and written out (console, SmartDashboard, network tables) by a 
+///     low priority background thread, so logging doesn't add I/O time to the robot loop.  Other 
+///     threads (parallel hardware setup, auton parsing, path generation) may log too; they share a 
+///     second queue behind a mutex so the robot loop's queue stays single producer and lock free.
 ///
 //========================================================================================================
 
 #pragma once
 
 // C++ Includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <set>
+#include <string_view>
+#include <thread>
 
 // FRC includes
 #include <networktables/NetworkTableInstance.h>
@@ -35,7 +45,8 @@
 #include <networktables/NetworkTableEntry.h>
 
 // Team 302 includes
-
+#include <utils/MatchLog.h>
+#include <utils/RingBuffer.h>
 
 // Third Party Includes
 
@@ -51,6 +62,7 @@ class Logger
         {
             CONSOLE,        ///< write to the RoboRio Console
             DASHBOARD,      ///< write to the SmartDashboard
+            FILE,           ///< write binary records to the match log in /home/lvuser/logs (decode with the matchLogDecoder tool)
             EAT_IT          ///< don't write anything (useful at comps where we want to minimize network traffic)
         };
 
@@ -84,6 +96,12 @@ class Logger
             LOGGER_LEVEL level    // <I> - Logging level
         );
 
+        /// @brief start a new match log if the FILE option is set and the last one was ended
+        void StartMatchLog();
+
+        /// @brief end the match log; the publisher closes (and trims) it after writing what is queued
+        void EndMatchLog();
+
         /// @brief log a message
         /// @param [in] std::string: classname or object identifier
         /// @param [in] std::string: message
@@ -151,6 +169,47 @@ class Logger
             double                              value 
         );
 
+        /// @brief Resolve a network table entry once and get a handle that can be used to write 
+        ///        to it every loop without any table or key lookups.  Registering the same table/identifier
+        ///        pair more than once returns the same handle.
+        /// @param [in] std::string: network table name
+        /// @param [in] std::string: entry identifier within the table
+        /// @returns int handle to pass into ToNtTable
+        int RegisterNtEntry
+        (
+            const std::string&  ntName,
+            const std::string&  identifier
+        );
+
+        /// @brief Write a value to a registered network table entry
+        /// @param [in] int: handle returned from RegisterNtEntry
+        /// @param [in] double: value to write
+        void ToNtTable
+        (
+            int                 handle,
+            double              value
+        );
+
+        /// @brief Write a message to a registered network table entry
+        /// @param [in] int: handle returned from RegisterNtEntry
+        /// @param [in] std::string: message to write
+        void ToNtTable
+        (
+            int                 handle,
+            const std::string&  msg
+        );
+
+        /// @brief number of log records that were thrown away because the queue was full
+        /// @returns uint64_t dropped record count
+        uint64_t GetDroppedCount() const;
+
+        /// @brief largest number of log records that have been waiting to be written at once
+        /// @returns uint64_t queue high water mark
+        uint64_t GetQueueHighWaterMark() const;
+
+        static constexpr int INVALID_NT_HANDLE = -1;
+        static constexpr int MAX_NT_ENTRIES = 1024;
+        static constexpr int MAX_ONCE_MESSAGES = 1024;
 
 
     protected:
@@ -158,11 +217,111 @@ class Logger
 
     private:
         Logger();
-        ~Logger() = default;
+        ~Logger();
+
+        /// @brief fixed size record passed from the robot loop to the publisher thread
+        struct LogRecord
+        {
+            enum RECORD_TYPE : uint8_t
+            {
+                CONSOLE_MSG,
+                DASHBOARD_MSG,
+                DASHBOARD_BOOL,
+                NT_DOUBLE,
+                NT_STRING,
+                FILE_MSG,
+                FILE_DOUBLE,
+                FILE_STRING
+            };
+
+            RECORD_TYPE     type;
+            bool            flag;
+            int             handle;
+            uint64_t        timestamp;      // FPGA microseconds; only filled in for FILE records
+            double          value;
+            char            location[64];
+            char            message[128];
+        };
+
+        void QueueRecord
+        (
+            LogRecord::RECORD_TYPE  type,
+            int                     handle,
+            double                  value,
+            bool                    flag,
+            const std::string&      location,
+            const std::string&      message
+        );
+
+        bool OpenMatchLog();
+        void PublishThread();
+        void Publish
+        (
+            const LogRecord&        record
+        );
+
+        int FindOrRegisterNtEntry
+        (
+            std::string_view    ntName,
+            std::string_view    identifier
+        );
+
+        /// @brief look up a registered entry without locking
+        /// @param [out] size_t: index slot to use if it isn't registered
+        int FindNtEntry
+        (
+            std::string_view    ntName,
+            std::string_view    identifier,
+            size_t&             freeSlot
+        ) const;
+
+        /// @brief true the first time a location/message pair is seen (lock free)
+        bool FirstTimeDisplayed
+        (
+            const std::string&  locationIdentifier,
+            const std::string&  message
+        );
+
+        using LogQueue = RingBuffer<LogRecord, 1024>;
 
         LOGGER_OPTION           m_option;
         LOGGER_LEVEL            m_level;
-        std::set<std::string>   m_alreadyDisplayed;
+
+        // hashes of the *_ONCE messages already shown; open addressed so any thread can check and
+        // insert without a lock (a hash collision hides a message, which is acceptable for these)
+        std::array<std::atomic<uint64_t>, 2*MAX_ONCE_MESSAGES>                      m_displayedOnce;
+
+        // registered entries are looked up through an open addressed index (hash of table and 
+        // identifier to handle) that is read without a lock; only registering a new entry takes
+        // m_registerMutex.  The entries are in fixed arrays because the publisher thread reads them
+        // while entries may still be registered.
+        std::array<nt::NetworkTableEntry, MAX_NT_ENTRIES>                           m_ntEntries;
+        std::array<std::string, MAX_NT_ENTRIES>                                     m_ntNames;
+        std::atomic<int>                                                            m_ntEntryCount;
+        std::array<std::atomic<int>, 2*MAX_NT_ENTRIES>                              m_ntIndex;
+        std::mutex                                                                  m_registerMutex;
+
+        // the thread that created the logger (the robot loop) is the only producer for m_queue;
+        // every other thread writes to m_workerQueue while holding m_workerMutex
+        std::thread::id                 m_loopThread;
+        LogQueue                        m_queue;
+        std::mutex                      m_workerMutex;
+        LogQueue                        m_workerQueue;
+        std::atomic<bool>               m_running;
+        int                             m_droppedHandle;
+        int                             m_highWaterHandle;
+
+        // match log state; the file is opened by the robot thread and written and closed only by
+        // the publisher thread.  m_matchLogMutex covers opening and closing.  Channel n+1 holds the 
+        // values for NT handle n.
+        MatchLog                                m_matchLog;
+        std::atomic<bool>                       m_matchLogOpen;
+        std::atomic<bool>                       m_closeMatchLog;
+        std::mutex                              m_matchLogMutex;
+        std::array<bool, MAX_NT_ENTRIES>        m_channelNamed;
+
+        std::thread                     m_publisher;
+
         static Logger*          m_instance;
 
 
@@ -0,0 +1,189 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// LoopProfiler.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Times the phases of the robot loop and writes a once a second summary to network tables.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+// FRC includes
+#include <networktables/NetworkTableInstance.h>
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableEntry.h>
+
+// Team 302 includes
+#include <utils/LoopProfiler.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    const array<string, LoopProfiler::PHASE::MAX_PHASES> PHASE_NAMES = 
+    { 
+        string("Chassis"), 
+        string("Intake"), 
+        string("Transfer"), 
+        string("Arm"), 
+        string("Release"), 
+        string("Pose Update"), 
+        string("Auton Primitive"), 
+        string("Sensor Refresh") 
+    };
+    const array<string, 4> STAT_NAMES = { string(" min (us)"), string(" mean (us)"), string(" p99 (us)"), string(" max (us)") };
+
+    constexpr auto SUMMARY_PERIOD = chrono::seconds(1);
+}
+
+/// @brief Find or create the loop profiler
+/// @returns LoopProfiler* pointer to the profiler
+LoopProfiler* LoopProfiler::m_instance = nullptr;
+LoopProfiler* LoopProfiler::GetInstance()
+{
+    if ( LoopProfiler::m_instance == nullptr )
+    {
+        LoopProfiler::m_instance = new LoopProfiler();
+    }
+    return LoopProfiler::m_instance;
+}
+
+LoopProfiler::LoopProfiler() : m_enabled( false ),
+                               m_stats(),
+                               m_periodStart( chrono::steady_clock::now() ),
+                               m_entries()
+{
+    auto table = nt::NetworkTableInstance::GetDefault().GetTable( "LoopProfiler" );
+    for ( auto phase=0; phase<PHASE::MAX_PHASES; ++phase )
+    {
+        for ( auto stat=0U; stat<STAT_NAMES.size(); ++stat )
+        {
+            m_entries[phase][stat] = table->GetEntry( PHASE_NAMES[phase] + STAT_NAMES[stat] );
+        }
+    }
+    Clear();
+}
+
+/// @brief turn timing on or off; turning it on starts a new summary period
+/// @param [in] bool: true to time phases
+void LoopProfiler::SetEnabled
+(
+    bool    enabled
+)
+{
+    if ( enabled && !m_enabled )
+    {
+        Clear();
+        m_periodStart = chrono::steady_clock::now();
+    }
+    m_enabled = enabled;
+}
+
+/// @brief add a sample to a phase's histogram
+/// @param [in] PHASE: phase that was timed
+/// @param [in] uint32_t: elapsed time in microseconds
+void LoopProfiler::AddSample
+(
+    PHASE       phase,
+    uint32_t    microseconds
+)
+{
+    if ( phase >= 0 && phase < PHASE::MAX_PHASES )
+    {
+        auto& stats = m_stats[phase];
+        auto bucket = min( microseconds / BUCKET_WIDTH_US, NUM_BUCKETS - 1 );
+        stats.histogram[bucket]++;
+        stats.count++;
+        stats.total += microseconds;
+        stats.min = min( stats.min, microseconds );
+        stats.max = max( stats.max, microseconds );
+    }
+}
+
+/// @brief call once per loop; writes the summary and starts a new period once a second
+void LoopProfiler::Periodic()
+{
+    if ( m_enabled )
+    {
+        auto now = chrono::steady_clock::now();
+        if ( now - m_periodStart >= SUMMARY_PERIOD )
+        {
+            Publish();
+            Clear();
+            m_periodStart = now;
+        }
+    }
+}
+
+void LoopProfiler::Publish()
+{
+    for ( auto phase=0; phase<PHASE::MAX_PHASES; ++phase )
+    {
+        const auto& stats = m_stats[phase];
+        if ( stats.count > 0 )
+        {
+            m_entries[phase][0].SetDouble( static_cast<double>( stats.min ) );
+            m_entries[phase][1].SetDouble( static_cast<double>( stats.total ) / static_cast<double>( stats.count ) );
+            m_entries[phase][2].SetDouble( static_cast<double>( GetPercentile( stats, 0.99 ) ) );
+            m_entries[phase][3].SetDouble( static_cast<double>( stats.max ) );
+        }
+    }
+}
+
+void LoopProfiler::Clear()
+{
+    for ( auto& stats : m_stats )
+    {
+        stats.histogram.fill( 0 );
+        stats.count = 0;
+        stats.min   = numeric_limits<uint32_t>::max();
+        stats.max   = 0;
+        stats.total = 0;
+    }
+}
+
+/// @brief upper edge (microseconds) of the bucket holding the given percentile
+uint32_t LoopProfiler::GetPercentile
+(
+    const PhaseStats&   stats,
+    double              percentile
+) const
+{
+    auto target = static_cast<uint32_t>( percentile * static_cast<double>( stats.count ) );
+    uint32_t seen = 0;
+    for ( auto bucket=0U; bucket<NUM_BUCKETS; ++bucket )
+    {
+        seen += stats.histogram[bucket];
+        if ( seen > target )
+        {
+            // samples past the end of the histogram are all in the last bucket, so use the max there
+            return ( bucket == NUM_BUCKETS - 1 ) ? stats.max : min( (bucket + 1) * BUCKET_WIDTH_US, stats.max );
+        }
+    }
+    return stats.max;
+}
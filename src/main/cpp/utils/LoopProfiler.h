@@ -0,0 +1,160 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// LoopProfiler.h
+//========================================================================================================
+///
+/// File Description:
+///     Times the phases of the robot loop (chassis, each mechanism, pose update, auton primitive).  
+///     Wrap a phase in a ScopedPhaseTimer; each sample goes into a fixed size histogram, and once a 
+///     second the min/mean/p99/max for every phase is written to the "LoopProfiler" network table
+///     and the histograms are cleared.  When the profiler is disabled a ScopedPhaseTimer is just a 
+///     flag check.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+// FRC includes
+#include <networktables/NetworkTableEntry.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class LoopProfiler
+{
+    public:
+
+        /// @enum PHASE
+        /// @brief Parts of the robot loop that are timed
+        enum PHASE
+        {
+            CHASSIS,            ///< teleop drive
+            INTAKE,             ///< intake state manager
+            TRANSFER,           ///< ball transfer state manager
+            ARM,                ///< arm state manager
+            RELEASE,            ///< ball release state manager
+            POSE_UPDATE,        ///< chassis pose update
+            AUTON_PRIMITIVE,    ///< running the current auton primitive
+            SENSOR_REFRESH,     ///< reading the motor controller sensors
+            MAX_PHASES
+        };
+
+        /// @brief Find or create the loop profiler
+        /// @returns LoopProfiler* pointer to the profiler
+        static LoopProfiler* GetInstance();
+
+        /// @brief turn timing on or off; turning it on starts a new summary period
+        /// @param [in] bool: true to time phases
+        void SetEnabled
+        (
+            bool    enabled
+        );
+
+        inline bool IsEnabled() const { return m_enabled; }
+
+        /// @brief add a sample to a phase's histogram
+        /// @param [in] PHASE: phase that was timed
+        /// @param [in] uint32_t: elapsed time in microseconds
+        void AddSample
+        (
+            PHASE       phase,
+            uint32_t    microseconds
+        );
+
+        /// @brief call once per loop; writes the summary and starts a new period once a second
+        void Periodic();
+
+        static constexpr uint32_t BUCKET_WIDTH_US = 20;     ///< histogram resolution
+        static constexpr uint32_t NUM_BUCKETS     = 1000;   ///< 20 ms; longer samples go in the last bucket
+
+    private:
+        LoopProfiler();
+        ~LoopProfiler() = default;
+
+        struct PhaseStats
+        {
+            std::array<uint32_t, NUM_BUCKETS>   histogram;
+            uint32_t                            count;
+            uint32_t                            min;
+            uint32_t                            max;
+            uint64_t                            total;
+        };
+
+        void Publish();
+        void Clear();
+
+        /// @brief upper edge (microseconds) of the bucket holding the given percentile
+        uint32_t GetPercentile
+        (
+            const PhaseStats&   stats,
+            double              percentile
+        ) const;
+
+        bool                                                    m_enabled;
+        std::array<PhaseStats, MAX_PHASES>                      m_stats;
+        std::chrono::steady_clock::time_point                   m_periodStart;
+
+        // min, mean, p99, max for each phase
+        std::array<std::array<nt::NetworkTableEntry, 4>, MAX_PHASES> m_entries;
+
+        static LoopProfiler*    m_instance;
+};
+
+/// @brief times the enclosing scope and adds it to the phase when the timer goes out of scope
+class ScopedPhaseTimer
+{
+    public:
+        explicit ScopedPhaseTimer
+        (
+            LoopProfiler::PHASE     phase
+        ) : m_profiler( LoopProfiler::GetInstance() ),
+            m_phase( phase ),
+            m_enabled( m_profiler->IsEnabled() ),
+            m_start()
+        {
+            if ( m_enabled )
+            {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~ScopedPhaseTimer()
+        {
+            if ( m_enabled )
+            {
+                auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - m_start );
+                m_profiler->AddSample( m_phase, static_cast<uint32_t>( elapsed.count() ) );
+            }
+        }
+
+        ScopedPhaseTimer( const ScopedPhaseTimer& ) = delete;
+        ScopedPhaseTimer& operator=( const ScopedPhaseTimer& ) = delete;
+
+    private:
+        LoopProfiler*                           m_profiler;
+        LoopProfiler::PHASE                     m_phase;
+        bool                                    m_enabled;
+        std::chrono::steady_clock::time_point   m_start;
+};
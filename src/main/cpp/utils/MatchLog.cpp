@@ -0,0 +1,324 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// MatchLog.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Append only binary log file (see MatchLogFormat.h) used by the Logger's FILE option.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/MatchLog.h>
+#include <utils/MatchLogFormat.h>
+
+// Third Party Includes
+
+using namespace std;
+using namespace MatchLogFormat;
+
+
+MatchLog::MatchLog() : m_fd( -1 ),
+                       m_mappedSize( 0 ),
+                       m_header( nullptr ),
+                       m_records( nullptr ),
+                       m_capacity( 0 ),
+                       m_count( 0 ),
+                       m_dropped( 0 ),
+                       m_fileName()
+{
+}
+
+MatchLog::~MatchLog()
+{
+    Close();
+}
+
+/// @brief create a new, preallocated log file in the directory and map it into memory; the
+///        oldest logs in the directory are deleted first to stay within the retention limits
+/// @param [in] std::string: directory to create the log in (created if needed)
+/// @param [in] uint64_t: number of records to preallocate
+/// @param [in] uint64_t: FPGA time (microseconds) the log is being started
+/// @returns bool true if the file is ready to write to
+bool MatchLog::Open
+(
+    const string&   directory,
+    uint64_t        maxRecords,
+    uint64_t        fpgaTime
+)
+{
+    Close();
+
+    mkdir( directory.c_str(), 0755 );
+    RemoveOldLogs( directory, sizeof(FileHeader) + maxRecords * sizeof(Record) );
+
+    // name the file from the wall clock; the RIO clock may not be set yet (no DS connection) so
+    // add a suffix rather than overwrite an existing log
+    auto now = time( nullptr );
+    struct tm parts;
+    localtime_r( &now, &parts );
+    char stamp[32];
+    strftime( stamp, sizeof(stamp), "match_%Y%m%d_%H%M%S", &parts );
+
+    for ( auto attempt=0; attempt<100 && m_fd < 0; ++attempt )
+    {
+        m_fileName = directory + "/" + stamp;
+        if ( attempt > 0 )
+        {
+            m_fileName += "_" + to_string(attempt);
+        }
+        m_fileName += ".bin";
+        m_fd = open( m_fileName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644 );
+        if ( m_fd < 0 && errno != EEXIST )
+        {
+            break;
+        }
+    }
+    if ( m_fd < 0 )
+    {
+        return false;
+    }
+
+    m_mappedSize = sizeof(FileHeader) + maxRecords * sizeof(Record);
+
+    // allocate the blocks now so a write never has to wait on the file system growing the file
+    if ( posix_fallocate( m_fd, 0, static_cast<off_t>(m_mappedSize) ) != 0 )
+    {
+        Close();
+        return false;
+    }
+
+    auto addr = mmap( nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0 );
+    if ( addr == MAP_FAILED )
+    {
+        Close();
+        return false;
+    }
+
+    m_header   = static_cast<FileHeader*>( addr );
+    m_records  = reinterpret_cast<Record*>( static_cast<char*>(addr) + sizeof(FileHeader) );
+    m_capacity = maxRecords;
+    m_count    = 0;
+    m_dropped  = 0;
+
+    memset( m_header, 0, sizeof(FileHeader) );
+    m_header->magic          = MAGIC;
+    m_header->version        = VERSION;
+    m_header->recordSize     = sizeof(Record);
+    m_header->wallClockStart = static_cast<uint64_t>( now );
+    m_header->fpgaStart      = fpgaTime;
+    m_header->capacity       = maxRecords;
+    m_header->recordCount    = 0;
+    return true;
+}
+
+/// @brief unmap the file and trim it to the records that were written
+void MatchLog::Close()
+{
+    if ( m_header != nullptr )
+    {
+        msync( m_header, m_mappedSize, MS_SYNC );
+        munmap( m_header, m_mappedSize );
+    }
+    if ( m_fd >= 0 )
+    {
+        if ( m_header != nullptr )
+        {
+            ftruncate( m_fd, static_cast<off_t>(sizeof(FileHeader) + m_count * sizeof(Record)) );
+        }
+        close( m_fd );
+    }
+
+    m_fd         = -1;
+    m_mappedSize = 0;
+    m_header     = nullptr;
+    m_records    = nullptr;
+    m_capacity   = 0;
+}
+
+/// @brief delete the oldest match logs in the directory until a new one of newBytes fits the limits
+void MatchLog::RemoveOldLogs
+(
+    const string&   directory,
+    uint64_t        newBytes
+) const
+{
+    struct LogFile
+    {
+        string      path;
+        time_t      modified;
+        uint64_t    bytes;
+    };
+
+    auto dir = opendir( directory.c_str() );
+    if ( dir == nullptr )
+    {
+        return;
+    }
+
+    vector<LogFile> logs;
+    uint64_t totalBytes = 0;
+    for ( auto entry = readdir( dir ); entry != nullptr; entry = readdir( dir ) )
+    {
+        string_view name( entry->d_name );
+        if ( name.substr( 0, 6 ) != "match_" || name.size() < 4 || name.substr( name.size() - 4 ) != ".bin" )
+        {
+            continue;
+        }
+        auto path = directory + "/" + string( name );
+        struct stat info;
+        if ( stat( path.c_str(), &info ) == 0 )
+        {
+            logs.emplace_back( LogFile{ path, info.st_mtime, static_cast<uint64_t>( info.st_size ) } );
+            totalBytes += static_cast<uint64_t>( info.st_size );
+        }
+    }
+    closedir( dir );
+
+    // the names come from the wall clock, which isn't set until the DS connects, so go by when 
+    // the file was last written
+    sort( logs.begin(), logs.end(), []( const LogFile& a, const LogFile& b ) 
+                                    { return a.modified != b.modified ? a.modified < b.modified : a.path < b.path; } );
+    for ( size_t inx=0; inx<logs.size(); ++inx )
+    {
+        auto remaining = logs.size() - inx;
+        if ( remaining < MAX_RETAINED_FILES && totalBytes + newBytes <= MAX_RETAINED_BYTES )
+        {
+            break;
+        }
+        unlink( logs[inx].path.c_str() );
+        totalBytes -= logs[inx].bytes;
+    }
+}
+
+/// @brief define the name for a channel; must be written before the channel's first value
+void MatchLog::WriteChannelName
+(
+    uint64_t            timestamp,
+    uint16_t            channel,
+    string_view         name
+)
+{
+    WriteText( timestamp, channel, RECORD_TYPE::CHANNEL_NAME, name );
+}
+
+void MatchLog::WriteDouble
+(
+    uint64_t            timestamp,
+    uint16_t            channel,
+    double              value
+)
+{
+    if ( m_records == nullptr )
+    {
+        return;
+    }
+    if ( m_count >= m_capacity )
+    {
+        m_dropped++;
+        return;
+    }
+
+    auto& record     = m_records[m_count];
+    record.timestamp = timestamp;
+    record.channel   = channel;
+    record.type      = RECORD_TYPE::DOUBLE_VALUE;
+    record.length    = 0;
+    record.reserved  = 0;
+    record.value     = value;
+
+    m_count++;
+    m_header->recordCount = m_count;
+}
+
+void MatchLog::WriteString
+(
+    uint64_t            timestamp,
+    uint16_t            channel,
+    string_view         text
+)
+{
+    WriteText( timestamp, channel, RECORD_TYPE::STRING_VALUE, text );
+}
+
+/// @brief ask the kernel to start writing dirty pages back to flash (doesn't wait for it)
+void MatchLog::Flush()
+{
+    if ( m_header != nullptr )
+    {
+        msync( m_header, m_mappedSize, MS_ASYNC );
+    }
+}
+
+void MatchLog::WriteText
+(
+    uint64_t            timestamp,
+    uint16_t            channel,
+    RECORD_TYPE         type,
+    string_view         text
+)
+{
+    if ( m_records == nullptr )
+    {
+        return;
+    }
+
+    // the text is split across one record plus however many chunks it needs; it is all or nothing
+    // so the decoder never sees a partial string
+    uint64_t needed = text.empty() ? 1 : ( text.size() + TEXT_BYTES - 1 ) / TEXT_BYTES;
+    if ( m_count + needed > m_capacity )
+    {
+        m_dropped += needed;
+        return;
+    }
+
+    size_t offset = 0;
+    for ( uint64_t i=0; i<needed; ++i )
+    {
+        auto& record     = m_records[m_count + i];
+        auto  len        = min( text.size() - offset, static_cast<size_t>(TEXT_BYTES) );
+        record.timestamp = timestamp;
+        record.channel   = channel;
+        record.type      = ( i == 0 ) ? type : RECORD_TYPE::STRING_CHUNK;
+        record.length    = static_cast<uint8_t>( len );
+        record.reserved  = 0;
+        memset( record.text, 0, TEXT_BYTES );
+        memcpy( record.text, text.data() + offset, len );
+        offset += len;
+    }
+
+    m_count += needed;
+    m_header->recordCount = m_count;
+}
@@ -0,0 +1,124 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// MatchLog.h
+//========================================================================================================
+///
+/// File Description:
+///     Append only binary log file (see MatchLogFormat.h) used by the Logger's FILE option.  The file 
+///     is preallocated and memory mapped when it is opened, so writing a record is just a copy into
+///     memory; the kernel writes the pages back to flash.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/MatchLogFormat.h>
+
+// Third Party Includes
+
+
+class MatchLog
+{
+    public:
+        MatchLog();
+        ~MatchLog();
+
+        /// @brief create a new, preallocated log file in the directory and map it into memory; the
+        ///        oldest logs in the directory are deleted first to stay within the retention limits
+        /// @param [in] std::string: directory to create the log in (created if needed)
+        /// @param [in] uint64_t: number of records to preallocate
+        /// @param [in] uint64_t: FPGA time (microseconds) the log is being started
+        /// @returns bool true if the file is ready to write to
+        bool Open
+        (
+            const std::string&  directory,
+            uint64_t            maxRecords,
+            uint64_t            fpgaTime
+        );
+
+        /// @brief unmap the file and trim it to the records that were written
+        void Close();
+
+        bool IsOpen() const { return m_records != nullptr; }
+
+        /// @brief define the name for a channel; must be written before the channel's first value
+        void WriteChannelName
+        (
+            uint64_t            timestamp,
+            uint16_t            channel,
+            std::string_view    name
+        );
+
+        void WriteDouble
+        (
+            uint64_t            timestamp,
+            uint16_t            channel,
+            double              value
+        );
+
+        void WriteString
+        (
+            uint64_t            timestamp,
+            uint16_t            channel,
+            std::string_view    text
+        );
+
+        /// @brief ask the kernel to start writing dirty pages back to flash (doesn't wait for it)
+        void Flush();
+
+        /// @brief number of records that didn't fit in the file
+        uint64_t GetDroppedCount() const { return m_dropped; }
+
+        const std::string& GetFileName() const { return m_fileName; }
+
+        static constexpr size_t     MAX_RETAINED_FILES = 20;                    // logs kept, including the new one
+        static constexpr uint64_t   MAX_RETAINED_BYTES = 128ULL * 1024 * 1024;  // bytes kept, including the new one
+
+    private:
+        /// @brief delete the oldest match logs in the directory until a new one of newBytes fits the limits
+        void RemoveOldLogs
+        (
+            const std::string&                  directory,
+            uint64_t                            newBytes
+        ) const;
+
+        void WriteText
+        (
+            uint64_t                            timestamp,
+            uint16_t                            channel,
+            MatchLogFormat::RECORD_TYPE         type,
+            std::string_view                    text
+        );
+
+        int                             m_fd;
+        size_t                          m_mappedSize;
+        MatchLogFormat::FileHeader*     m_header;
+        MatchLogFormat::Record*         m_records;
+        uint64_t                        m_capacity;
+        uint64_t                        m_count;
+        uint64_t                        m_dropped;
+        std::string                     m_fileName;
+};
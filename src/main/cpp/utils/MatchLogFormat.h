@@ -0,0 +1,89 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// MatchLogFormat.h
+//========================================================================================================
+///
+/// File Description:
+///     On disk layout of the binary match log.  This header is shared by the robot code (MatchLog) and 
+///     the desktop decoder, so it must only use standard C++.
+///
+///     The file is a FileHeader followed by fixed size 32 byte Records.  Each record holds a timestamp,
+///     a channel id and either a double or up to 16 bytes of text.  Text longer than that (channel 
+///     names, string values) continues in STRING_CHUNK records that immediately follow it.  A channel's
+///     CHANNEL_NAME record is always written before its first value.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+namespace MatchLogFormat
+{
+    constexpr uint32_t  MAGIC           = 0x474C4D33;   // "3MLG" 
+    constexpr uint16_t  VERSION         = 1;
+    constexpr uint16_t  MESSAGE_CHANNEL = 0;            // LogError/OnDash text
+    constexpr int       TEXT_BYTES      = 16;
+
+    /// @enum RECORD_TYPE
+    /// @brief what the payload of a record holds
+    enum RECORD_TYPE : uint8_t
+    {
+        CHANNEL_NAME = 1,   ///< text is (the start of) the channel's name
+        DOUBLE_VALUE,       ///< value holds a double
+        STRING_VALUE,       ///< text is (the start of) a string value
+        STRING_CHUNK        ///< continuation of the text in the previous record
+    };
+
+    struct FileHeader
+    {
+        uint32_t    magic;
+        uint16_t    version;
+        uint16_t    recordSize;
+        uint64_t    wallClockStart;     ///< seconds since the unix epoch when the log was opened
+        uint64_t    fpgaStart;          ///< FPGA time (microseconds) when the log was opened
+        uint64_t    capacity;           ///< number of records the file can hold
+        uint64_t    recordCount;        ///< number of records written so far
+        uint8_t     reserved[24];
+    };
+
+    struct Record
+    {
+        uint64_t    timestamp;          ///< FPGA time in microseconds
+        uint16_t    channel;
+        uint8_t     type;               ///< RECORD_TYPE
+        uint8_t     length;             ///< number of text bytes used in this record
+        uint32_t    reserved;
+        union
+        {
+            double  value;
+            char    text[TEXT_BYTES];
+        };
+    };
+
+    static_assert( sizeof(FileHeader) == 64, "MatchLogFormat::FileHeader must stay 64 bytes" );
+    static_assert( sizeof(Record) == 32, "MatchLogFormat::Record must stay 32 bytes" );
+}
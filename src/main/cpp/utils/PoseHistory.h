@@ -0,0 +1,133 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// PoseHistory.h
+//========================================================================================================
+///
+/// File Description:
+///     Fixed size, time indexed history of robot poses.  Once full, the oldest pose is overwritten, so 
+///     adding a pose never allocates.  Sample() interpolates between the two poses around a time.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstddef>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <units/time.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+template <size_t SIZE>
+class PoseHistory
+{
+    static_assert( SIZE > 1, "PoseHistory SIZE must hold at least two poses" );
+
+    public:
+        PoseHistory() : m_entries(), 
+                        m_next( 0 ), 
+                        m_count( 0 )
+        {
+        }
+        ~PoseHistory() = default;
+
+        /// @brief record a pose; times must be added in increasing order
+        /// @param [in] units::second_t time - when the robot was at the pose
+        /// @param [in] const frc::Pose2d& pose - the pose
+        void Add
+        (
+            units::second_t         time,
+            const frc::Pose2d&      pose
+        )
+        {
+            m_entries[m_next].time = time;
+            m_entries[m_next].pose = pose;
+            m_next = ( m_next + 1 ) % SIZE;
+            if ( m_count < SIZE )
+            {
+                m_count++;
+            }
+        }
+
+        /// @brief forget every pose (e.g. after the pose is reset)
+        void Clear()
+        {
+            m_next  = 0;
+            m_count = 0;
+        }
+
+        /// @brief find the pose at a time, interpolating between the recorded poses around it
+        /// @param [in] units::second_t time - time to look up
+        /// @param [out] frc::Pose2d& pose - pose at that time
+        /// @returns bool false if the time is older than the history (or there is no history); 
+        ///          times newer than the history return the latest pose
+        bool Sample
+        (
+            units::second_t         time,
+            frc::Pose2d&            pose
+        ) const
+        {
+            if ( m_count == 0 )
+            {
+                return false;
+            }
+
+            // walk back from the newest entry until we find one at or before the time
+            const Entry* newer = nullptr;
+            for ( size_t inx=0; inx<m_count; ++inx )
+            {
+                auto& entry = m_entries[( m_next + SIZE - 1 - inx ) % SIZE];
+                if ( entry.time <= time )
+                {
+                    if ( newer == nullptr || newer->time <= entry.time )
+                    {
+                        pose = entry.pose;
+                    }
+                    else
+                    {
+                        auto fraction = ( ( time - entry.time ) / ( newer->time - entry.time ) ).to<double>();
+                        auto translation = entry.pose.Translation() + ( newer->pose.Translation() - entry.pose.Translation() ) * fraction;
+                        auto rotation = entry.pose.Rotation() + ( newer->pose.Rotation() - entry.pose.Rotation() ) * fraction;
+                        pose = frc::Pose2d( translation, rotation );
+                    }
+                    return true;
+                }
+                newer = &entry;
+            }
+            return false;
+        }
+
+        inline size_t GetCount() const { return m_count; }
+
+    private:
+        struct Entry
+        {
+            units::second_t     time;
+            frc::Pose2d         pose;
+        };
+
+        std::array<Entry, SIZE>     m_entries;
+        size_t                      m_next;
+        size_t                      m_count;
+};
@@ -0,0 +1,151 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// RingBuffer.h
+//========================================================================================================
+///
+/// File Description:
+///     Fixed size, lock-free, single producer / single consumer queue.  The producer (robot loop) never
+///     blocks or allocates; when the queue is full the item is dropped and counted.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+template <typename T, size_t SIZE>
+class RingBuffer
+{
+    static_assert( SIZE > 1 && (SIZE & (SIZE - 1)) == 0, "RingBuffer SIZE must be a power of two" );
+
+    public:
+        RingBuffer() : m_buffer(), 
+                       m_head( 0 ), 
+                       m_tail( 0 ), 
+                       m_dropped( 0 ),
+                       m_highWater( 0 )
+        {
+        }
+        ~RingBuffer() = default;
+
+        /// @brief add an item to the queue (producer thread only)
+        /// @param [in] const T& item - item to copy into the queue
+        /// @returns bool true if queued, false if the queue was full and the item was dropped
+        bool TryPush
+        (
+            const T&    item
+        )
+        {
+            auto head = m_head.load( std::memory_order_relaxed );
+            auto tail = m_tail.load( std::memory_order_acquire );
+            if ( head - tail >= SIZE )
+            {
+                m_dropped.fetch_add( 1, std::memory_order_relaxed );
+                return false;
+            }
+
+            m_buffer[head & MASK] = item;
+            m_head.store( head + 1, std::memory_order_release );
+
+            auto depth = head + 1 - tail;
+            if ( depth > m_highWater.load( std::memory_order_relaxed ) )
+            {
+                m_highWater.store( depth, std::memory_order_relaxed );
+            }
+            return true;
+        }
+
+        /// @brief get a writable slot in place so large records don't need to be built then copied; 
+        ///        the slot is only visible to the consumer once Commit() is called (producer thread only)
+        /// @returns T* slot to fill in or nullptr if the queue is full (the drop is counted)
+        T* Reserve()
+        {
+            auto head = m_head.load( std::memory_order_relaxed );
+            if ( head - m_tail.load( std::memory_order_acquire ) >= SIZE )
+            {
+                m_dropped.fetch_add( 1, std::memory_order_relaxed );
+                return nullptr;
+            }
+            return &m_buffer[head & MASK];
+        }
+
+        /// @brief publish the slot returned from Reserve() (producer thread only)
+        void Commit()
+        {
+            auto head = m_head.load( std::memory_order_relaxed ) + 1;
+            m_head.store( head, std::memory_order_release );
+
+            auto depth = head - m_tail.load( std::memory_order_relaxed );
+            if ( depth > m_highWater.load( std::memory_order_relaxed ) )
+            {
+                m_highWater.store( depth, std::memory_order_relaxed );
+            }
+        }
+
+        /// @brief remove the oldest item from the queue (consumer thread only)
+        /// @param [out] T& item - item that was removed
+        /// @returns bool true if an item was removed, false if the queue was empty
+        bool TryPop
+        (
+            T&          item
+        )
+        {
+            auto tail = m_tail.load( std::memory_order_relaxed );
+            if ( tail == m_head.load( std::memory_order_acquire ) )
+            {
+                return false;
+            }
+
+            item = m_buffer[tail & MASK];
+            m_tail.store( tail + 1, std::memory_order_release );
+            return true;
+        }
+
+        /// @brief number of items that were dropped because the queue was full
+        uint64_t GetDroppedCount() const { return m_dropped.load( std::memory_order_relaxed ); }
+
+        /// @brief largest number of items that have been waiting in the queue at once
+        uint64_t GetHighWaterMark() const { return m_highWater.load( std::memory_order_relaxed ); }
+
+        /// @brief approximate number of items currently waiting in the queue
+        uint64_t GetSize() const { return m_head.load( std::memory_order_relaxed ) - m_tail.load( std::memory_order_relaxed ); }
+
+        static constexpr size_t GetCapacity() { return SIZE; }
+
+    private:
+        static constexpr uint64_t MASK = SIZE - 1;
+
+        std::array<T, SIZE>     m_buffer;
+
+        // head and tail are written by different threads, so keep them on separate cache lines
+        alignas(64) std::atomic<uint64_t>   m_head;
+        alignas(64) std::atomic<uint64_t>   m_tail;
+        alignas(64) std::atomic<uint64_t>   m_dropped;
+        std::atomic<uint64_t>               m_highWater;
+};
@@ -0,0 +1,152 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TrajectoryTable.cpp
+//========================================================================================================
+///
+/// File Description:
+///     A trajectory resampled at a fixed time step.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/trajectory/Trajectory.h>
+#include <units/time.h>
+#include <wpi/numbers>
+
+// Team 302 includes
+#include <utils/TrajectoryTable.h>
+
+// Third Party Includes
+
+using namespace std;
+
+TrajectoryTable::TrajectoryTable() : m_step( DEFAULT_STEP.to<double>() ),
+                                     m_totalTime( 0 ),
+                                     m_x(),
+                                     m_y(),
+                                     m_heading(),
+                                     m_velocity(),
+                                     m_acceleration(),
+                                     m_curvature()
+{
+}
+
+void TrajectoryTable::Build
+(
+    const frc::Trajectory&  trajectory,
+    units::second_t         step
+)
+{
+    Clear();
+    if ( trajectory.States().empty() || step <= units::second_t(0) )
+    {
+        return;
+    }
+
+    m_step      = step.to<double>();
+    m_totalTime = trajectory.TotalTime();
+
+    // one entry per step plus one for the end of the trajectory
+    auto count = static_cast<size_t>( ceil( m_totalTime.to<double>() / m_step ) ) + 1;
+    m_x.reserve( count );
+    m_y.reserve( count );
+    m_heading.reserve( count );
+    m_velocity.reserve( count );
+    m_acceleration.reserve( count );
+    m_curvature.reserve( count );
+
+    for ( size_t inx=0; inx<count; ++inx )
+    {
+        auto time = units::second_t( min( inx * m_step, m_totalTime.to<double>() ) );
+        auto state = trajectory.Sample( time );
+        m_x.emplace_back( state.pose.X().to<double>() );
+        m_y.emplace_back( state.pose.Y().to<double>() );
+        m_heading.emplace_back( state.pose.Rotation().Radians().to<double>() );
+        m_velocity.emplace_back( state.velocity.to<double>() );
+        m_acceleration.emplace_back( state.acceleration.to<double>() );
+        m_curvature.emplace_back( state.curvature.to<double>() );
+    }
+}
+
+void TrajectoryTable::Clear()
+{
+    m_totalTime = units::second_t( 0 );
+    m_x.clear();
+    m_y.clear();
+    m_heading.clear();
+    m_velocity.clear();
+    m_acceleration.clear();
+    m_curvature.clear();
+}
+
+frc::Trajectory::State TrajectoryTable::Sample
+(
+    units::second_t         time
+) const
+{
+    if ( IsEmpty() )
+    {
+        return frc::Trajectory::State();
+    }
+
+    auto last = m_x.size() - 1;
+    auto position = time.to<double>() / m_step;
+    if ( position <= 0.0 )
+    {
+        return GetState( 0, 0.0 );
+    }
+    if ( position >= static_cast<double>( last ) )
+    {
+        return GetState( last, 0.0 );
+    }
+
+    auto index = static_cast<size_t>( position );
+    return GetState( index, position - static_cast<double>( index ) );
+}
+
+frc::Trajectory::State TrajectoryTable::GetState
+(
+    size_t                  index,
+    double                  fraction
+) const
+{
+    auto next = fraction > 0.0 ? index + 1 : index;
+    auto lerp = [index, next, fraction]( const vector<double>& values )
+    {
+        return values[index] + ( values[next] - values[index] ) * fraction;
+    };
+
+    // interpolate the heading the short way around so a path crossing +/-180 degrees doesn't spin
+    auto headingChange = remainder( m_heading[next] - m_heading[index], 2.0 * wpi::numbers::pi );
+
+    frc::Trajectory::State state;
+    state.t            = units::second_t( min( ( index + fraction ) * m_step, m_totalTime.to<double>() ) );
+    state.velocity     = units::meters_per_second_t( lerp( m_velocity ) );
+    state.acceleration = units::meters_per_second_squared_t( lerp( m_acceleration ) );
+    state.pose         = frc::Pose2d( units::meter_t( lerp( m_x ) ),
+                                      units::meter_t( lerp( m_y ) ),
+                                      frc::Rotation2d( units::radian_t( m_heading[index] + headingChange * fraction ) ) );
+    state.curvature    = units::curvature_t( lerp( m_curvature ) );
+    return state;
+}
@@ -0,0 +1,90 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TrajectoryTable.h
+//========================================================================================================
+///
+/// File Description:
+///     A trajectory resampled at a fixed time step.  Sample() is an index and a linear interpolation
+///     instead of the search frc::Trajectory::Sample() does.  Each field is kept in its own array.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <vector>
+
+// FRC includes
+#include <frc/trajectory/Trajectory.h>
+#include <units/time.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class TrajectoryTable
+{
+    public:
+        TrajectoryTable();
+        ~TrajectoryTable() = default;
+
+        /// @brief resample a trajectory; replaces whatever was in the table
+        /// @param [in] const frc::Trajectory& trajectory - trajectory to resample
+        /// @param [in] units::second_t step - time between table entries
+        void Build
+        (
+            const frc::Trajectory&  trajectory,
+            units::second_t         step = DEFAULT_STEP
+        );
+
+        /// @brief empty the table
+        void Clear();
+
+        /// @brief state at a time, interpolated between the table entries around it; times before
+        ///        the start or after the end return the first or last state
+        /// @param [in] units::second_t time - time since the start of the trajectory
+        /// @return frc::Trajectory::State - the state (default state if the table is empty)
+        frc::Trajectory::State Sample
+        (
+            units::second_t         time
+        ) const;
+
+        inline bool IsEmpty() const { return m_x.empty(); }
+        inline size_t GetSize() const { return m_x.size(); }
+        inline units::second_t GetTotalTime() const { return m_totalTime; }
+
+        static constexpr units::second_t DEFAULT_STEP = units::second_t(0.005);
+
+    private:
+        frc::Trajectory::State GetState
+        (
+            size_t                  index,
+            double                  fraction
+        ) const;
+
+        double                  m_step;             // seconds
+        units::second_t         m_totalTime;
+        std::vector<double>     m_x;                // meters
+        std::vector<double>     m_y;                // meters
+        std::vector<double>     m_heading;          // radians
+        std::vector<double>     m_velocity;         // meters per second
+        std::vector<double>     m_acceleration;     // meters per second squared
+        std::vector<double>     m_curvature;        // radians per meter
+};
@@ -40,10 +40,23 @@ shared_ptr<CANCoder> CanCoderDefn::ParseXML
 (
     xml_node CanCoderNode
 )
+{
+    string usage;
+    return ParseXML( CanCoderNode, usage );
+}
+
+/// @brief parses the cancoder node in the robot.xml file and creates a cancoder
+/// @param [in] xml_node - the cancoder element in the xml file
+/// @param [out] string& usage - the cancoder usage attribute
+/// @return shared_ptr<CANCoder
+shared_ptr<CANCoder> CanCoderDefn::ParseXML
+(
+    xml_node    CanCoderNode,
+    string&     usage
+)
 {
     shared_ptr<CANCoder> cancoder = nullptr;
 
-    string usage;
     int canID = 0;
     
     bool hasError = false;
@@ -18,6 +18,7 @@
 
 // C++ includes
 #include <memory>
+#include <string>
 
 // wpilib includes
 
@@ -37,4 +38,10 @@ class CanCoderDefn
         /// @param [in] xml_node - the cancoder element in the xml file
         /// @return shared_ptr<CANCoder
         std::shared_ptr<ctre::phoenix::sensors::CANCoder> ParseXML (pugi::xml_node  CanCoderNode);
+
+        /// @brief parses the cancoder node in the robot.xml file and creates a cancoder
+        /// @param [in] xml_node - the cancoder element in the xml file
+        /// @param [out] std::string& usage - the cancoder usage attribute
+        /// @return shared_ptr<CANCoder
+        std::shared_ptr<ctre::phoenix::sensors::CANCoder> ParseXML (pugi::xml_node  CanCoderNode, std::string& usage);
 };
\ No newline at end of file
@@ -32,13 +32,18 @@
 #include <units/angular_velocity.h>
 #include <units/length.h>
 #include <units/velocity.h>
+#include <units/voltage.h>
+#include <frc/controller/SimpleMotorFeedforward.h>
 
 
 // Team302 includes
+#include <controllers/ControlData.h>
+#include <controllers/ControlModes.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <subsys/ChassisFactory.h>
 #include <subsys/interfaces/IChassis.h>
 
+#include <xmlhw/CanCoderDefn.h>
 #include <xmlhw/ChassisDefn.h>
 #include <xmlhw/MotorDefn.h>
 #include <utils/Logger.h>
@@ -73,6 +78,13 @@ IChassis* ChassisDefn::ParseXML
     units::radians_per_second_t maxAngularSpeed(0.0);
     units::acceleration::meters_per_second_squared_t maxAcceleration(0.0);
     units::angular_acceleration::radians_per_second_squared_t maxAngularAcceleration(0.0);
+    bool velocityControl    = false;
+    double kP               = 0.0;
+    double kS               = 0.0;
+    double kV               = 0.0;
+    double kA               = 0.0;
+    double turnP            = 0.0;
+    double turnD            = 0.0;
     bool hasError 		    = false;
 
     // process attributes
@@ -131,6 +143,34 @@ IChassis* ChassisDefn::ParseXML
         {
         	wheelDiameter = units::length::inch_t(attr.as_double());
         }
+        else if (  attrName.compare("velocityControl") == 0 )
+        {
+            velocityControl = attr.as_bool();
+        }
+        else if (  attrName.compare("kP") == 0 )
+        {
+            kP = attr.as_double();
+        }
+        else if (  attrName.compare("kS") == 0 )
+        {
+            kS = attr.as_double();
+        }
+        else if (  attrName.compare("kV") == 0 )
+        {
+            kV = attr.as_double();
+        }
+        else if (  attrName.compare("kA") == 0 )
+        {
+            kA = attr.as_double();
+        }
+        else if (  attrName.compare("turnP") == 0 )
+        {
+            turnP = attr.as_double();
+        }
+        else if (  attrName.compare("turnD") == 0 )
+        {
+            turnD = attr.as_double();
+        }
         else   // log errors
         {
             string msg = "unknown attribute ";
@@ -144,6 +184,8 @@ IChassis* ChassisDefn::ParseXML
     // Process child element nodes
     IDragonMotorControllerMap motors;
     unique_ptr<MotorDefn> motorXML = make_unique<MotorDefn>();
+    map<string, shared_ptr<ctre::phoenix::sensors::CANCoder>> canCoders;
+    unique_ptr<CanCoderDefn> canCoderXML = make_unique<CanCoderDefn>();
 
     for (xml_node child = chassisNode.first_child(); child; child = child.next_sibling())
     {
@@ -155,6 +197,15 @@ IChassis* ChassisDefn::ParseXML
                 motors[ motor.get()->GetType() ] =  motor ;
             }
     	}
+    	else if ( strcmp( child.name(), "canCoder") == 0 )
+    	{
+            string usage;
+            auto canCoder = canCoderXML.get()->ParseXML(child, usage);
+            if ( canCoder.get() != nullptr )
+            {
+                canCoders[ usage ] = canCoder;
+            }
+    	}
     	else  // log errors
     	{
             string msg = "unknown child ";
@@ -167,6 +218,40 @@ IChassis* ChassisDefn::ParseXML
     // create chassis instance
     if ( !hasError )
     {
+        // velocity mode runs a P loop on the motor controllers; kS/kV/kA are sent as arbitrary feed forward
+        shared_ptr<ControlData> velocityControlData;
+        if ( velocityControl )
+        {
+            velocityControlData = make_shared<ControlData>( ControlModes::CONTROL_TYPE::VELOCITY_INCH,
+                                                            ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
+                                                            string("chassisVelocity"),
+                                                            kP,
+                                                            0.0,
+                                                            0.0,
+                                                            0.0,
+                                                            0.0,
+                                                            0.0,
+                                                            0.0,
+                                                            1.0,
+                                                            0.0 );
+        }
+        // swerve turn motors hold the module angle with a position loop on the motor controller
+        auto turnControlData = make_shared<ControlData>( ControlModes::CONTROL_TYPE::POSITION_DEGREES,
+                                                         ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
+                                                         string("swerveTurn"),
+                                                         turnP,
+                                                         0.0,
+                                                         turnD,
+                                                         0.0,
+                                                         0.0,
+                                                         0.0,
+                                                         0.0,
+                                                         1.0,
+                                                         0.0 );
+        frc::SimpleMotorFeedforward<units::meters> feedforward( units::volt_t(kS), 
+                                                                 kV * 1_V * 1_s / 1_m, 
+                                                                 kA * 1_V * 1_s * 1_s / 1_m );
+
         auto factory = ChassisFactory::GetChassisFactory();
         if ( factory != nullptr )
         {
@@ -178,7 +263,11 @@ IChassis* ChassisDefn::ParseXML
                                               maxAngularSpeed,
                                               maxAcceleration,
                                               maxAngularAcceleration,
-                                              motors );
+                                              motors,
+                                              velocityControlData,
+                                              feedforward,
+                                              canCoders,
+                                              turnControlData );
         }
         else  // log errors
         {
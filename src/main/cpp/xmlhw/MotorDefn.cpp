@@ -240,26 +240,33 @@ shared_ptr<IDragonMotorController> MotorDefn::ParseXML
 
     if ( !hasError )
     {
-		pdpID = ( pdpID < 0 ) ? canID : pdpID;
-        controller = DragonMotorControllerFactory::GetInstance()->CreateMotorController( mtype,
-                                                                                         canID,
-                                                                                         pdpID,
-                                                                                         usage,
-                                                                                         inverted,
-                                                                                         sensorInverted,
-                                                                                         feedbackDevice,
-                                                                                         countsPerRev,
-                                                                                         gearRatio,
-                                                                                         brakeMode,
-                                                                                         slaveTo,
-                                                                                         peakCurrentLimit,
-                                                                                         peakCurrentDuration,
-                                                                                         peakCurrentLimit,
-                                                                                         enableCurrentLimit,
-                                                                                         forwardLimitSwitch,
-                                                                                         forwardLimitSwitchNormallyOpen,
-                                                                                         reverseLimitSwitch,
-                                                                                         reverseLimitSwitchNormallyOpen );
+        // RobotDefn builds every motor controller before the chassis and mechanisms are parsed,
+        // so use that controller if it has already been created
+        auto factory = DragonMotorControllerFactory::GetInstance();
+        controller = factory->GetController( canID );
+        if ( controller.get() == nullptr )
+        {
+            pdpID = ( pdpID < 0 ) ? canID : pdpID;
+            controller = factory->CreateMotorController( mtype,
+                                                         canID,
+                                                         pdpID,
+                                                         usage,
+                                                         inverted,
+                                                         sensorInverted,
+                                                         feedbackDevice,
+                                                         countsPerRev,
+                                                         gearRatio,
+                                                         brakeMode,
+                                                         slaveTo,
+                                                         peakCurrentLimit,
+                                                         peakCurrentDuration,
+                                                         peakCurrentLimit,
+                                                         enableCurrentLimit,
+                                                         forwardLimitSwitch,
+                                                         forwardLimitSwitchNormallyOpen,
+                                                         reverseLimitSwitch,
+                                                         reverseLimitSwitchNormallyOpen );
+        }
     }
     return controller;
 }
@@ -26,15 +26,22 @@
 ///     This parsing code will call the classes/methods to parse the lower-level objects.  When the parsing
 ///     has been completed, the robot hardware will be defined.
 ///
-///     The robot definition XML file is:  /home/lvuser/config/robot.xml
+///     The robot definition XML file is:  /home/lvuser/config/robot.xml, falling back to robot.xml in the
+///     deploy directory (/home/lvuser/deploy on the robot, src/main/deploy on the desktop).
 ///
 //========================================================================================================
 
 // C++ Includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <memory>
+#include <thread>
+#include <vector>
 
 // FRC includes
+#include <frc/Filesystem.h>
 
 // Team 302 includes
 #include <xmlhw/CameraDefn.h>
@@ -43,7 +50,9 @@
 #include <xmlhw/MechanismDefn.h>
 #include <xmlhw/LimelightDefn.h>
 #include <xmlhw/PigeonDefn.h>
+#include <xmlhw/MotorDefn.h>
 #include <hw/DragonPigeon.h>
+#include <hw/factories/DragonMotorControllerFactory.h>
 #include <utils/Logger.h>
 
 // Third Party Includes
@@ -53,6 +62,68 @@ using namespace frc;
 using namespace pugi;
 using namespace std;
 
+namespace
+{
+    // controller construction mostly waits on CAN round trips, so a few workers is plenty
+    constexpr size_t MOTOR_WORKER_THREADS = 4;
+
+    /// @brief create every chassis and mechanism motor controller, spread across a few worker threads.
+    ///        Each constructor blocks on its CAN configuration, so this takes about as long as the 
+    ///        slowest controller rather than the sum of all of them.  Returns once they are all built.
+    void CreateMotorControllers
+    (
+        xml_node        parent
+    )
+    {
+        vector<xml_node> motorNodes;
+        for (xml_node node = parent.first_child(); node; node = node.next_sibling())
+        {
+            for (xml_node child = node.first_child(); child; child = child.next_sibling())
+            {
+                if (strcmp(child.name(), "chassis") == 0 || strcmp(child.name(), "mechanism") == 0)
+                {
+                    for (xml_node motor = child.child("motor"); motor; motor = motor.next_sibling("motor"))
+                    {
+                        motorNodes.emplace_back(motor);
+                    }
+                }
+            }
+        }
+
+        // create the singletons the workers share before they start
+        Logger::GetLogger();
+        DragonMotorControllerFactory::GetInstance();
+
+        atomic<size_t> next(0);
+        auto worker = [&motorNodes, &next]()
+        {
+            auto motorXML = make_unique<MotorDefn>();
+            for (auto inx = next++; inx < motorNodes.size(); inx = next++)
+            {
+                try
+                {
+                    motorXML.get()->ParseXML(motorNodes[inx]);
+                }
+                catch (const exception& e)
+                {
+                    Logger::GetLogger()->LogError(string("RobotDefn::CreateMotorControllers"), string(e.what()));
+                }
+            }
+        };
+
+        vector<thread> workers;
+        auto numWorkers = min(MOTOR_WORKER_THREADS, motorNodes.size());
+        for (auto inx = 0U; inx < numWorkers; ++inx)
+        {
+            workers.emplace_back(worker);
+        }
+        for (auto& workerThread : workers)
+        {
+            workerThread.join();
+        }
+    }
+}
+
 
 //-----------------------------------------------------------------------
 // Method:      ParseXML
@@ -71,7 +142,7 @@ void RobotDefn::ParseXML()
         xml_parse_result result = doc.load_file(filename.c_str());
         if (!result)
         {
-            filename = string("/home/lvuser/deploy/robot.xml");
+            filename = frc::filesystem::GetDeployDirectory() + string("/robot.xml");
             result = doc.load_file(filename.c_str());
             Logger::GetLogger()->LogError(string("RobotXML Parsing"), string("using deploy version"));
         }   
@@ -87,6 +158,11 @@ void RobotDefn::ParseXML()
 
             // get the root node <robot>
             xml_node parent = doc.root();
+
+            // build the motor controllers first (in parallel); the chassis and mechanisms below are only
+            // wired up after they are all done and pick up the finished controllers by CAN ID
+            CreateMotorControllers(parent);
+
             for (xml_node node = parent.first_child(); node; node = node.next_sibling())
             {
                 // loop through the direct children of <robot> and call the appropriate parser
@@ -26,7 +26,7 @@
 ///     This parsing leverages the 3rd party Open Source Pugixml library (https://pugixml.org/).
 ///
 ///     The state definition XML files are in:  /home/lvuser/config/states/XXX.xml where the XXX
-///     is the mechanism name.
+///     is the mechanism name, falling back to states/XXX.xml in the deploy directory.
 ///
 //========================================================================================================
 
@@ -37,6 +37,7 @@
 #include <iostream>
 
 // FRC includes
+#include <frc/Filesystem.h>
 
 // Team 302 includes
 #include <xmlmechdata/StateDataDefn.h>
@@ -98,7 +99,7 @@ vector<MechanismTargetData*> StateDataDefn::ParseXML
 
         if (!result)
         {
-            filename = string("/home/lvuser/deploy/states/");
+            filename = frc::filesystem::GetDeployDirectory() + string("/states/");
             filename += mech;
             result = doc.load_file(filename.c_str());
         }
@@ -0,0 +1,161 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// StateMachineTest.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Checks StateMachine::NextState and IsValid on a small three state machine whose guards read a
+///     two button snapshot, the same way the mechanism state managers use the controller buttons.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <array>
+
+// FRC includes
+
+// Team 302 includes
+#include <states/StateMachine.h>
+#include <states/StateStruc.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+namespace
+{
+    enum TEST_STATE
+    {
+        OFF,
+        FORWARD,
+        REVERSE,
+        MAX_TEST_STATES
+    };
+
+    enum TEST_BUTTON
+    {
+        FORWARD_BUTTON,
+        REVERSE_BUTTON,
+        MAX_TEST_BUTTONS
+    };
+
+    using Buttons = std::array<bool, MAX_TEST_BUTTONS>;
+    using TEST_STATE_MACHINE = StateMachine<TEST_STATE, MAX_TEST_STATES, Buttons>;
+
+    constexpr bool ForwardPressed( const Buttons& buttons ) { return buttons[FORWARD_BUTTON]; }
+    constexpr bool ReversePressed( const Buttons& buttons ) { return buttons[REVERSE_BUTTON]; }
+    constexpr bool NothingPressed( const Buttons& buttons ) { return !ForwardPressed( buttons ) && !ReversePressed( buttons ); }
+
+    constexpr TEST_STATE_MACHINE::StateTable TEST_STATES =
+    {{
+        { "OFF",     TEST_STATE::OFF,     StateType::INTAKE, true  },
+        { "FORWARD", TEST_STATE::FORWARD, StateType::INTAKE, false },
+        { "REVERSE", TEST_STATE::REVERSE, StateType::INTAKE, false }
+    }};
+
+    // forward wins over reverse; letting go of both goes back to off
+    constexpr TEST_STATE_MACHINE::TransitionTable<4> TEST_TRANSITIONS =
+    {{
+        { TEST_STATE::OFF,     ForwardPressed, TEST_STATE::FORWARD },
+        { TEST_STATE::OFF,     ReversePressed, TEST_STATE::REVERSE },
+        { TEST_STATE::FORWARD, NothingPressed, TEST_STATE::OFF     },
+        { TEST_STATE::REVERSE, NothingPressed, TEST_STATE::OFF     }
+    }};
+}
+
+TEST( StateMachineTest, NextStateTakesTheFirstTrueGuard )
+{
+    EXPECT_EQ( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::OFF, Buttons{ true, false } ), TEST_STATE::FORWARD );
+    EXPECT_EQ( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::OFF, Buttons{ false, true } ), TEST_STATE::REVERSE );
+    EXPECT_EQ( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::OFF, Buttons{ true, true } ), TEST_STATE::FORWARD );
+}
+
+TEST( StateMachineTest, NextStateStaysWhenNoGuardIsTrue )
+{
+    EXPECT_EQ( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::OFF, Buttons{ false, false } ), TEST_STATE::OFF );
+    EXPECT_EQ( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::FORWARD, Buttons{ true, false } ), TEST_STATE::FORWARD );
+}
+
+TEST( StateMachineTest, NextStateOnlyChecksTransitionsOutOfTheCurrentState )
+{
+    // REVERSE has no transition on the forward button, so holding both keeps it reversing
+    EXPECT_EQ( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::REVERSE, Buttons{ true, true } ), TEST_STATE::REVERSE );
+    EXPECT_EQ( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::REVERSE, Buttons{ false, false } ), TEST_STATE::OFF );
+}
+
+TEST( StateMachineTest, NextStateIsConstexpr )
+{
+    static_assert( TEST_STATE_MACHINE::NextState( TEST_TRANSITIONS, TEST_STATE::OFF, Buttons{ false, true } ) == TEST_STATE::REVERSE,
+                   "NextState should be usable at compile time" );
+}
+
+TEST( StateMachineTest, StateTableIsValid )
+{
+    EXPECT_TRUE( TEST_STATE_MACHINE::IsValid( TEST_STATES ) );
+}
+
+TEST( StateMachineTest, StateTableOutOfOrderIsInvalid )
+{
+    TEST_STATE_MACHINE::StateTable states =
+    {{
+        { "FORWARD", TEST_STATE::FORWARD, StateType::INTAKE, false },
+        { "OFF",     TEST_STATE::OFF,     StateType::INTAKE, true  },
+        { "REVERSE", TEST_STATE::REVERSE, StateType::INTAKE, false }
+    }};
+    EXPECT_FALSE( TEST_STATE_MACHINE::IsValid( states ) );
+}
+
+TEST( StateMachineTest, StateTableNeedsExactlyOneDefault )
+{
+    auto noDefault = TEST_STATES;
+    noDefault[TEST_STATE::OFF].isDefault = false;
+    EXPECT_FALSE( TEST_STATE_MACHINE::IsValid( noDefault ) );
+
+    auto twoDefaults = TEST_STATES;
+    twoDefaults[TEST_STATE::REVERSE].isDefault = true;
+    EXPECT_FALSE( TEST_STATE_MACHINE::IsValid( twoDefaults ) );
+}
+
+TEST( StateMachineTest, TransitionTableIsValid )
+{
+    EXPECT_TRUE( TEST_STATE_MACHINE::IsValid( TEST_TRANSITIONS ) );
+}
+
+TEST( StateMachineTest, TransitionToItselfIsInvalid )
+{
+    auto transitions = TEST_TRANSITIONS;
+    transitions[0].to = TEST_STATE::OFF;
+    EXPECT_FALSE( TEST_STATE_MACHINE::IsValid( transitions ) );
+}
+
+TEST( StateMachineTest, TransitionOutOfRangeIsInvalid )
+{
+    auto transitions = TEST_TRANSITIONS;
+    transitions[1].to = TEST_STATE::MAX_TEST_STATES;
+    EXPECT_FALSE( TEST_STATE_MACHINE::IsValid( transitions ) );
+
+    transitions = TEST_TRANSITIONS;
+    transitions[2].from = static_cast<TEST_STATE>( -1 );
+    EXPECT_FALSE( TEST_STATE_MACHINE::IsValid( transitions ) );
+}
+
+TEST( StateMachineTest, TransitionWithoutGuardIsInvalid )
+{
+    auto transitions = TEST_TRANSITIONS;
+    transitions[3].guard = nullptr;
+    EXPECT_FALSE( TEST_STATE_MACHINE::IsValid( transitions ) );
+}
@@ -0,0 +1,178 @@
+
+//====================================================================================================================================================
+// Copyright 2021 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// MatchLogDecoder.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Desktop tool that converts a binary match log (written by the Logger FILE option) to CSV.
+///
+///     usage: matchLogDecoder <match log> [<csv file>]
+///
+///     The CSV has one row per value:  time (seconds since the log was opened), channel name, value.
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/MatchLogFormat.h>
+
+// Third Party Includes
+
+using namespace std;
+using namespace MatchLogFormat;
+
+namespace
+{
+    /// @brief quote a CSV field if it contains a separator, quote or newline
+    string CsvField
+    (
+        const string&   text
+    )
+    {
+        if ( text.find_first_of( ",\"\n" ) == string::npos )
+        {
+            return text;
+        }
+
+        string quoted( "\"" );
+        for ( auto c : text )
+        {
+            if ( c == '"' )
+            {
+                quoted += '"';
+            }
+            quoted += c;
+        }
+        quoted += '"';
+        return quoted;
+    }
+
+    /// @brief gather the text from a record and any STRING_CHUNK records that follow it
+    /// @returns size_t index of the last record used
+    size_t ReadText
+    (
+        const vector<Record>&   records,
+        size_t                  index,
+        string&                 text
+    )
+    {
+        text.assign( records[index].text, records[index].length );
+        while ( index + 1 < records.size() && 
+                records[index+1].type == RECORD_TYPE::STRING_CHUNK && 
+                records[index+1].channel == records[index].channel )
+        {
+            ++index;
+            text.append( records[index].text, records[index].length );
+        }
+        return index;
+    }
+}
+
+int main
+(
+    int     argc,
+    char**  argv
+)
+{
+    if ( argc < 2 )
+    {
+        cerr << "usage: " << argv[0] << " <match log> [<csv file>]" << endl;
+        return 1;
+    }
+
+    ifstream in( argv[1], ios::binary );
+    if ( !in )
+    {
+        cerr << "unable to open " << argv[1] << endl;
+        return 1;
+    }
+
+    FileHeader header;
+    if ( !in.read( reinterpret_cast<char*>(&header), sizeof(header) ) || header.magic != MAGIC )
+    {
+        cerr << argv[1] << " is not a match log" << endl;
+        return 1;
+    }
+    if ( header.version != VERSION || header.recordSize != sizeof(Record) )
+    {
+        cerr << argv[1] << " is match log version " << header.version << "; this decoder reads version " << VERSION << endl;
+        return 1;
+    }
+
+    // a log from a robot that lost power was never trimmed, so trust the header's record count
+    vector<Record> records( header.recordCount );
+    in.read( reinterpret_cast<char*>(records.data()), static_cast<streamsize>(records.size() * sizeof(Record)) );
+    records.resize( static_cast<size_t>(in.gcount()) / sizeof(Record) );
+
+    ofstream file;
+    if ( argc > 2 )
+    {
+        file.open( argv[2] );
+        if ( !file )
+        {
+            cerr << "unable to create " << argv[2] << endl;
+            return 1;
+        }
+    }
+    ostream& out = ( argc > 2 ) ? file : cout;
+
+    map<uint16_t, string> names;
+    names[MESSAGE_CHANNEL] = "message";
+
+    out << "time,channel,value" << '\n';
+    string text;
+    for ( size_t i=0; i<records.size(); ++i )
+    {
+        const auto& record = records[i];
+        auto time = static_cast<double>( record.timestamp - header.fpgaStart ) / 1.0e6;
+        auto name = names.find( record.channel );
+        auto channelName = ( name != names.end() ) ? name->second : "channel " + to_string(record.channel);
+
+        switch ( record.type )
+        {
+            case RECORD_TYPE::CHANNEL_NAME:
+                i = ReadText( records, i, text );
+                names[record.channel] = text;
+                break;
+
+            case RECORD_TYPE::DOUBLE_VALUE:
+                out << time << ',' << CsvField(channelName) << ',' << record.value << '\n';
+                break;
+
+            case RECORD_TYPE::STRING_VALUE:
+                i = ReadText( records, i, text );
+                out << time << ',' << CsvField(channelName) << ',' << CsvField(text) << '\n';
+                break;
+
+            default:    // orphaned STRING_CHUNK or a newer record type; skip it
+                break;
+        }
+    }
+
+    cerr << records.size() << " records decoded (" << header.capacity << " allocated)" << endl;
+    return 0;
+}